@@ -0,0 +1,182 @@
+#include <vsg/all.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <random>
+#include <thread>
+
+#include <vsgXchange/all.h>
+
+namespace vsgbase64bench
+{
+    std::string encode(const std::vector<uint8_t>& data)
+    {
+        const char* alphabet = "ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz0123456789+/";
+
+        std::string encoded;
+        encoded.reserve(((data.size() + 2) / 3) * 4);
+
+        size_t i = 0;
+        for (; i + 3 <= data.size(); i += 3)
+        {
+            uint32_t v = (uint32_t(data[i]) << 16) | (uint32_t(data[i + 1]) << 8) | uint32_t(data[i + 2]);
+            encoded.push_back(alphabet[(v >> 18) & 0x3f]);
+            encoded.push_back(alphabet[(v >> 12) & 0x3f]);
+            encoded.push_back(alphabet[(v >> 6) & 0x3f]);
+            encoded.push_back(alphabet[v & 0x3f]);
+        }
+
+        size_t remaining = data.size() - i;
+        if (remaining > 0)
+        {
+            uint32_t v = uint32_t(data[i]) << 16;
+            if (remaining == 2) v |= uint32_t(data[i + 1]) << 8;
+            encoded.push_back(alphabet[(v >> 18) & 0x3f]);
+            encoded.push_back(alphabet[(v >> 12) & 0x3f]);
+            encoded.push_back(remaining == 2 ? alphabet[(v >> 6) & 0x3f] : '=');
+            encoded.push_back('=');
+        }
+
+        return encoded;
+    }
+
+    /// the scalar lookup table decoder that gltf::decodeBase64 replaced, used as the reference for correctness and performance.
+    void decode_reference(const std::string_view& value, uint8_t* dest, size_t destSize)
+    {
+        auto decode_base64 = [](char c) -> uint8_t {
+            if (c >= 'A' && c <= 'Z') return c - 'A';
+            if (c >= 'a' && c <= 'z') return c - 'a' + 26;
+            if (c >= '0' && c <= '9') return c - '0' + 52;
+            if (c == '+') return 62;
+            if (c == '/') return 63;
+            return 0;
+        };
+
+        uint8_t lookup[256];
+        for (uint32_t c = 0; c < 256; ++c)
+        {
+            lookup[c] = decode_base64(static_cast<char>(c));
+        }
+
+        auto dest_itr = dest;
+        auto dest_end = dest + destSize;
+        auto src_itr = value.begin();
+
+        size_t count = std::min(value.size() / 4, destSize / 3);
+        size_t srcTailCount = value.size() - count * 4;
+        size_t destTailCount = destSize - count * 3;
+        for (; count > 0; --count)
+        {
+            const uint8_t decodedBytes[4] = {lookup[static_cast<uint8_t>(*(src_itr++))], lookup[static_cast<uint8_t>(*(src_itr++))], lookup[static_cast<uint8_t>(*(src_itr++))], lookup[static_cast<uint8_t>(*(src_itr++))]};
+
+            (*dest_itr++) = static_cast<uint8_t>((decodedBytes[0] << 2) + ((decodedBytes[1] & 0x30) >> 4));
+            (*dest_itr++) = static_cast<uint8_t>(((decodedBytes[1] & 0x0f) << 4) + ((decodedBytes[2] & 0x3c) >> 2));
+            (*dest_itr++) = static_cast<uint8_t>(((decodedBytes[2] & 0x03) << 6) + decodedBytes[3]);
+        }
+
+        if (srcTailCount != 0 && destTailCount != 0)
+        {
+            const uint8_t decodedBytes[4] = {
+                lookup[static_cast<uint8_t>(*(src_itr++))],
+                srcTailCount >= 2 ? lookup[static_cast<uint8_t>(*(src_itr++))] : uint8_t(0),
+                srcTailCount >= 3 ? lookup[static_cast<uint8_t>(*(src_itr++))] : uint8_t(0),
+                srcTailCount >= 4 ? lookup[static_cast<uint8_t>(*(src_itr++))] : uint8_t(0)};
+
+            (*dest_itr++) = static_cast<uint8_t>((decodedBytes[0] << 2) + ((decodedBytes[1] & 0x30) >> 4));
+            if (destTailCount >= 2) (*dest_itr++) = static_cast<uint8_t>(((decodedBytes[1] & 0x0f) << 4) + ((decodedBytes[2] & 0x3c) >> 2));
+            if (destTailCount >= 3) (*dest_itr++) = static_cast<uint8_t>(((decodedBytes[2] & 0x03) << 6) + decodedBytes[3]);
+        }
+
+        for (; dest_itr != dest_end; ++dest_itr)
+        {
+            *dest_itr = 0;
+        }
+    }
+
+    template<typename F>
+    double bestTime(int iterations, F function)
+    {
+        double best = std::numeric_limits<double>::max();
+        for (int i = 0; i < iterations; ++i)
+        {
+            auto start = std::chrono::steady_clock::now();
+            function();
+            best = std::min(best, std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count());
+        }
+        return best;
+    }
+} // namespace vsgbase64bench
+
+int main(int argc, char** argv)
+{
+    vsg::CommandLine arguments(&argc, argv);
+
+    if (arguments.read({"--help", "-h"}))
+    {
+        std::cout << "Usage: vsgbase64bench [--size MB] [--iterations n] [--threads n] [--invalid n]" << std::endl;
+        std::cout << "Compares gltf::decodeBase64 against the scalar reference decoder, returning 1 if their outputs differ." << std::endl;
+        return 0;
+    }
+
+    auto size = arguments.value<size_t>(256, {"--size", "-s"}) * 1024 * 1024;
+    auto iterations = arguments.value<int>(5, {"--iterations", "-i"});
+    auto numThreads = arguments.value<uint32_t>(std::thread::hardware_concurrency(), {"--threads", "-t"});
+    // replace every nth encoded character with one outside of the base64 alphabet to exercise the fallback for invalid blocks.
+    auto invalidInterval = arguments.value<size_t>(0, "--invalid");
+
+    if (arguments.errors()) return arguments.writeErrorMessages(std::cerr);
+
+    std::vector<uint8_t> data(size);
+    std::mt19937 generator(1);
+    for (auto& value : data) value = static_cast<uint8_t>(generator());
+
+    auto encoded = vsgbase64bench::encode(data);
+    if (invalidInterval > 0)
+    {
+        for (size_t i = invalidInterval - 1; i < encoded.size(); i += invalidInterval) encoded[i] = '-';
+    }
+
+    // strip the padding as the glTF reader does before decoding.
+    std::string_view value(encoded);
+    while (!value.empty() && value.back() == '=') value.remove_suffix(1);
+
+    std::vector<uint8_t> reference(size);
+    std::vector<uint8_t> decoded(size);
+    double encodedMB = double(value.size()) / (1024.0 * 1024.0);
+
+    auto report = [&](const char* name, double seconds) {
+        std::cout << "    " << name << " : " << seconds * 1000.0 << "ms, " << (encodedMB / 1024.0) / seconds << "GB/s" << std::endl;
+    };
+
+    std::cout << "Decoding " << encodedMB << "MB of base64 encoded data, best of " << iterations << " iterations" << std::endl;
+
+    report("scalar reference", vsgbase64bench::bestTime(iterations, [&]() { vsgbase64bench::decode_reference(value, reference.data(), reference.size()); }));
+
+    int result = 0;
+    auto check = [&](const char* name) {
+        if (std::memcmp(reference.data(), decoded.data(), size) != 0)
+        {
+            std::cerr << "Error: " << name << " output differs from the scalar reference." << std::endl;
+            result = 1;
+        }
+    };
+
+    report("decodeBase64", vsgbase64bench::bestTime(iterations, [&]() { vsgXchange::gltf::decodeBase64(value, decoded.data(), decoded.size()); }));
+    check("decodeBase64");
+
+    if (numThreads > 0)
+    {
+        auto operationThreads = vsg::OperationThreads::create(numThreads);
+        std::memset(decoded.data(), 0xff, decoded.size());
+
+        report("decodeBase64 with operationThreads", vsgbase64bench::bestTime(iterations, [&]() { vsgXchange::gltf::decodeBase64(value, decoded.data(), decoded.size(), operationThreads); }));
+        check("decodeBase64 with operationThreads");
+
+        operationThreads->stop();
+    }
+
+    return result;
+}
@@ -58,6 +58,7 @@ namespace vsgXchange
         static constexpr const char* instancing = "instancing";                 /// bool, hint for using vsg::InstanceNode/InstanceDraw for instancing where possible.
         static constexpr const char* pixel_ratio = "pixel_ratio";               /// double, sets the Builder::pixelErrorToScreenHeightRatio value used for setting LOD ranges.
         static constexpr const char* pre_load_level = "pre_load_level";         /// uint, sets the Builder::preLoadLevel values to control what LOD level are pre loaded when reading a tileset.
+        static constexpr const char* probe = "probe";                           /// bool, return a gltf::Summary of b3dm, i3dm and cmpt content rather than building the scene graph, defaults to false
         static constexpr const char* prototype_builder = "Tiles3D::Builder";    /// Tiles3D::Builder prototype cloned for converting Tiles3D::Tileset hierachy into VSG scene graph
 
         bool readOptions(vsg::Options& options, vsg::CommandLine& arguments) const override;
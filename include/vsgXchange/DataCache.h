@@ -0,0 +1,104 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shimages be included in images
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Data.h>
+#include <vsg/io/Options.h>
+#include <vsg/utils/SharedObjects.h>
+#include <vsgXchange/Version.h>
+
+#include <future>
+#include <map>
+#include <mutex>
+#include <vector>
+
+namespace vsgXchange
+{
+
+    /// 128 bit hash of a block of memory.
+    struct DataHash
+    {
+        uint64_t low = 0;
+        uint64_t high = 0;
+
+        bool operator==(const DataHash& rhs) const { return low == rhs.low && high == rhs.high; }
+        bool operator!=(const DataHash& rhs) const { return !(*this == rhs); }
+        bool operator<(const DataHash& rhs) const { return high < rhs.high || (high == rhs.high && low < rhs.low); }
+    };
+
+    /// compute the 128 bit MurmurHash3 (x64 variant) of a block of memory.
+    extern VSGXCHANGE_DECLSPEC DataHash hash(const void* ptr, size_t size, uint64_t seed = 0);
+
+    /// Cache of vsg::Data keyed by a hash of their contents, used to share byte identical arrays between loads.
+    /// Obtain the DataCache associated with a vsg::SharedObjects via sharedObjects->shareDefault<vsgXchange::DataCache>()
+    /// so that all loads using the same vsg::Options::sharedObjects share the same cache.
+    class VSGXCHANGE_DECLSPEC DataCache : public vsg::Inherit<vsg::Object, DataCache>
+    {
+    public:
+        DataCache();
+
+        /// return a previously cached vsg::Data with the same type, format and contents as data if one exists,
+        /// otherwise add a standalone copy of data to the cache and return it. Thread safe.
+        vsg::ref_ptr<vsg::Data> share(vsg::ref_ptr<vsg::Data> data);
+
+        template<class T>
+        vsg::ref_ptr<T> share(vsg::ref_ptr<T> data)
+        {
+            return share(vsg::ref_ptr<vsg::Data>(data)).template cast<T>();
+        }
+
+        /// return the vsg::Data previously read from a block of encoded data, such as an embedded .png or .jpg, with the same contents,
+        /// extensionHint and mapRGBtoRGBAHint, otherwise read it using vsg::read_cast<vsg::Data>(ptr, size, options) and cache the result.
+        /// Concurrent reads of the same encoded data wait for the first read to complete rather than decoding it again. Thread safe.
+        vsg::ref_ptr<vsg::Data> read(const uint8_t* ptr, size_t size, vsg::ref_ptr<const vsg::Options> options);
+
+        /// release the cached vsg::Data that are no longer referenced outside of the cache, returning the number released.
+        /// Called automatically as the cache grows so that data from unloaded tiles doesn't stay resident. Thread safe.
+        size_t prune();
+
+        /// number of unique vsg::Data held by the cache.
+        size_t size() const;
+
+        /// number of share(..) and read(..) calls that returned previously cached data.
+        size_t hits() const;
+
+        void clear();
+
+    protected:
+        virtual ~DataCache();
+
+        mutable std::mutex _mutex;
+        std::map<DataHash, std::vector<vsg::ref_ptr<vsg::Data>>> _entries;
+        std::map<DataHash, std::shared_future<vsg::ref_ptr<vsg::Data>>> _encodedEntries;
+        size_t _size = 0;
+        size_t _hits = 0;
+        size_t _pruneThreshold = 64;
+
+        size_t _prune();
+        void _pruneIfRequired();
+    };
+
+} // namespace vsgXchange
+
+EVSG_type_name(vsgXchange::DataCache)
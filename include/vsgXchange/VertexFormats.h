@@ -0,0 +1,53 @@
+#pragma once
+
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of
+this software and associated documentation files (the "Software"), to deal in
+the Software without restriction, including without limitation the rights to
+use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of
+the Software, and to permit persons to whom the Software is furnished to do so,
+subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all
+copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR
+IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS
+FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER
+IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN
+CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsg/core/Array.h>
+#include <vsgXchange/Version.h>
+
+namespace vsgXchange
+{
+
+    /// pack skinning joint indices and weights into 8 or 16 bit per component vertex arrays, a quarter or half the size of ivec4/vec4 arrays.
+    /// Joint indices are packed into a ubvec4Array or usvec4Array with a VK_FORMAT_R8G8B8A8_SINT or VK_FORMAT_R16G16B16A16_SINT format, using the
+    /// smallest that holds the largest index, so that they match the ivec4 vsg_JointIndices shader input.
+    /// Weights are packed into a normalized ubvec4Array, or usvec4Array when weights16bit is true, and renormalized after quantization so each vertex's weights sum to 1.
+    /// jointIndices may be an ivec4Array, ubvec4Array or usvec4Array, jointWeights a vec4Array or normalized ubvec4Array or usvec4Array.
+    /// Returns false, leaving packedIndices and packedWeights unchanged, when the arrays aren't supported or indices are out of range of the packed formats.
+    extern VSGXCHANGE_DECLSPEC bool packJoints(const vsg::Data& jointIndices, const vsg::Data& jointWeights, bool weights16bit, vsg::ref_ptr<vsg::Data>& packedIndices, vsg::ref_ptr<vsg::Data>& packedWeights);
+
+    /// compress a vec3Array of normals into a svec4Array with a VK_FORMAT_R16G16B16A16_SNORM format, two thirds the size of the vec3Array.
+    /// Vulkan converts SNORM formats back to float on vertex fetch so the vec3 vsg_Normal shader input is used unchanged.
+    /// Returns null when normals isn't a vec3Array.
+    extern VSGXCHANGE_DECLSPEC vsg::ref_ptr<vsg::Data> compressNormals(const vsg::Data& normals);
+
+    /// compress a vec2Array of texture coordinates into a usvec2Array of half floats with a VK_FORMAT_R16G16_SFLOAT format, half the size of the vec2Array.
+    /// Returns null when texCoords isn't a vec2Array or has coordinates outside the range -4 to 4, beyond which half float precision is coarser than 1/512.
+    extern VSGXCHANGE_DECLSPEC vsg::ref_ptr<vsg::Data> compressTexCoords(const vsg::Data& texCoords);
+
+    /// compress a vec3Array or vec4Array of colors into a ubvec4Array with a VK_FORMAT_R8G8B8A8_UNORM format, a quarter the size of a vec4Array.
+    /// Components are clamped to the 0 to 1 range and vec3 colors are given an alpha of 1. Returns null for other array types.
+    extern VSGXCHANGE_DECLSPEC vsg::ref_ptr<vsg::Data> compressColors(const vsg::Data& colors);
+
+} // namespace vsgXchange
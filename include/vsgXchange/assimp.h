@@ -96,6 +96,9 @@ namespace vsgXchange
         static constexpr const char* culling = "culling";                                 /// bool, insert cull nodes, defaults to true
         static constexpr const char* vertex_color_space = "vertex_color_space";           /// CoordinateSpace {sRGB or LINEAR} to assume when reading vertex colors
         static constexpr const char* material_color_space = "material_color_space";       /// CoordinateSpace {sRGB or LINEAR} to assume when reading materials colors
+        static constexpr const char* share_images = "share_images";                       /// bool, share images decoded from byte identical embedded textures between loads that use the same vsg::Options::sharedObjects, defaults to false
+        static constexpr const char* packed_joints = "packed_joints";                     /// bool, pack the joint indices of skinned meshes into 8 bit, or 16 bit when joints exceed 127, and the weights into 8 bit per component vertex arrays, defaults to false
+        static constexpr const char* compress_vertices = "compress_vertices";             /// bool, store normals as 16 bit SNORM, texture coordinates as half floats and colors as 8 bit UNORM vertex arrays, defaults to false
         static constexpr const char* prototype_builder = "assimp::Builder";               /// assimp::Builder prototype used for converted aiScene into VSG scene graph
 
         bool readOptions(vsg::Options& options, vsg::CommandLine& arguments) const override;
@@ -162,6 +165,9 @@ namespace vsgXchange
             bool externalTextures = false;
             TextureFormat externalTextureFormat = TextureFormat::native;
             bool culling = true;
+            bool shareImages = false;
+            bool packedJoints = false;
+            bool compressVertices = false;
 
             // set for the file format being read.
             vsg::CoordinateSpace sourceVertexColorSpace = vsg::CoordinateSpace::LINEAR;
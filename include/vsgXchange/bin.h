@@ -23,6 +23,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 </editor-fold> */
 
+#include <vsg/core/Array.h>
 #include <vsg/io/JSONParser.h>
 #include <vsg/io/ReaderWriter.h>
 #include <vsgXchange/Version.h>
@@ -45,6 +46,32 @@ namespace vsgXchange
         bool supportedExtension(const vsg::Path& ext) const;
 
         bool getFeatures(Features& features) const override;
+
+        static constexpr const char* memory_map = "memory_map"; /// bool, memory map .bin files so pages are only loaded from disk once accessed, defaults to false
+
+        bool readOptions(vsg::Options& options, vsg::CommandLine& arguments) const override;
+    };
+
+    /// vsg::ubyteArray whose contents are a read-only, copy-on-write memory mapping of a file.
+    /// Views created with MappedData as their storage keep the mapping alive, so accessors and images
+    /// can reference the file contents directly, with the mapping released once the last view is deleted.
+    /// Cloning a MappedData creates a conventional vsg::ubyteArray copy of the file contents.
+    class VSGXCHANGE_DECLSPEC MappedData : public vsg::ubyteArray
+    {
+    public:
+        explicit MappedData(const vsg::Path& filename);
+
+        MappedData(const MappedData&) = delete;
+        MappedData& operator=(const MappedData&) = delete;
+
+        /// return a MappedData of the specified file, or a null ref_ptr if the file could not be mapped.
+        static vsg::ref_ptr<MappedData> create(const vsg::Path& filename);
+
+    protected:
+        virtual ~MappedData();
+
+        void* _mappedAddress = nullptr;
+        size_t _mappedSize = 0;
     };
 
 } // namespace vsgXchange
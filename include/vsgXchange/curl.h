@@ -43,6 +43,7 @@ namespace vsgXchange
 
         // vsg::Options::setValue(str, value) supported options:
         static constexpr const char* SSL_OPTIONS = "CURLOPT_SSL_OPTIONS"; ///  uint32_t
+        static constexpr const char* STREAMING = "curl_streaming";        ///  bool, pass .glb files to the gltf reader as they download rather than once complete, defaults to false
 
         /// specify whether libcurl should be initialized and cleaned up by vsgXchange::curl.
         static bool s_do_curl_global_init_and_cleanup; // defaults to true
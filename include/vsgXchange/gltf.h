@@ -29,9 +29,13 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <vsg/io/JSONParser.h>
 #include <vsg/io/ReaderWriter.h>
 #include <vsg/lighting/Light.h>
+#include <vsg/maths/box.h>
+#include <vsg/threading/OperationThreads.h>
 #include <vsg/utils/GraphicsPipelineConfigurator.h>
 #include <vsgXchange/Version.h>
 
+#include <functional>
+
 namespace vsgXchange
 {
 
@@ -48,18 +52,50 @@ namespace vsgXchange
         vsg::ref_ptr<vsg::Object> read_gltf(std::istream&, vsg::ref_ptr<const vsg::Options>, const vsg::Path& filename = {}) const;
         vsg::ref_ptr<vsg::Object> read_glb(std::istream&, vsg::ref_ptr<const vsg::Options>, const vsg::Path& filename = {}) const;
 
+        /// read a GLB held in memory, the binary chunk is referenced directly by the vsg::Data created for buffers, bufferViews and accessors rather than copied.
+        vsg::ref_ptr<vsg::Object> read_glb(vsg::ref_ptr<vsg::ubyteArray> glb, vsg::ref_ptr<const vsg::Options>, const vsg::Path& filename = {}) const;
+
+        /// parse the JSON in parser.buffer and build the scene graph, binaryData, if set, is the binary chunk of a GLB file.
+        vsg::ref_ptr<vsg::Object> read_glb_json(vsg::JSONParser& parser, vsg::ref_ptr<vsg::Data> binaryData, vsg::ref_ptr<const vsg::Options>, const vsg::Path& filename = {}) const;
+
+        /// parse the JSON in parser.buffer and build the scene graph, readBinaryData is called once the JSON has been parsed to get the binary chunk of a GLB file, allowing it to be read while the JSON is parsed.
+        vsg::ref_ptr<vsg::Object> read_glb_json(vsg::JSONParser& parser, const std::function<vsg::ref_ptr<vsg::Data>()>& readBinaryData, vsg::ref_ptr<const vsg::Options>, const vsg::Path& filename = {}) const;
+
         vsg::Logger::Level level = vsg::Logger::LOGGER_WARN;
 
         bool supportedExtension(const vsg::Path& ext) const;
 
         bool getFeatures(Features& features) const override;
 
-        static constexpr const char* report = "report";                     /// bool, report parsed glTF to console, defaults to false
-        static constexpr const char* culling = "culling";                   /// bool, insert cull nodes, defaults to true
-        static constexpr const char* disable_gltf = "disable_gltf";         /// bool, disable vsgXchange::gltf so vsgXchange::assimp will be used instead, defaults to false
-        static constexpr const char* clone_accessors = "clone_accessors";   /// bool, hint to clone the data associated with accessors, defaults to false
-        static constexpr const char* maxAnisotropy = "maxAnisotropy";       /// float, default setting of vsg::Sampler::maxAnisotropy to use.
-        static constexpr const char* prototype_builder = "gltf::Builder";   /// gltf::Builder prototype cloned for converting gltf::glTF hierachy into VSG scene graph
+        static constexpr const char* report = "report";                                       /// bool, report parsed glTF to console, defaults to false
+        static constexpr const char* culling = "culling";                                     /// bool, insert cull nodes, defaults to true
+        static constexpr const char* disable_gltf = "disable_gltf";                           /// bool, disable vsgXchange::gltf so vsgXchange::assimp will be used instead, defaults to false
+        static constexpr const char* animation_sample_rate = "animation_sample_rate";         /// float, resample LINEAR animation channels to this many keys per second, 0 disables resampling, defaults to 0
+        static constexpr const char* animation_tolerance = "animation_tolerance";             /// float, collapse constant animation channels and remove keys reconstructed by interpolation within this error, in model units for translations and scales and radians for rotations, 0 disables, defaults to 0
+        static constexpr const char* clone_accessors = "clone_accessors";                     /// bool, hint to clone the data associated with accessors, defaults to false
+        static constexpr const char* cluster_size = "cluster_size";                           /// uint32_t, split opaque indexed triangle primitives with more triangles than this into spatially coherent clusters of this many triangles, each with its own vsg::CullNode, 0 disables, defaults to 0
+        static constexpr const char* compact_buffers = "compact_buffers";                     /// bool, copy the ranges of the binary buffers used by accessors into tightly packed arrays and release the buffers once images are read, reducing resident memory, defaults to false
+        static constexpr const char* compress_vertices = "compress_vertices";                 /// bool, store float normals as 16 bit SNORM, texture coordinates as half floats and colors as 8 bit UNORM vertex arrays, defaults to false
+        static constexpr const char* flatten_static_transforms = "flatten_static_transforms"; /// bool, bake the transforms of nodes that aren't animated or joints into their vertex data and remove them from the hierarchy, ignored when instanceNodeHint is set, defaults to false
+        static constexpr const char* instance_threshold = "instance_threshold";               /// uint32_t, minimum number of static nodes referencing a mesh for them to be drawn by a single vsg::InstanceNode, 0 disables, ignored when instanceNodeHint is set, defaults to 0
+        static constexpr const char* interleaved_vertices = "interleaved_vertices";           /// bool, bind vertex attributes that share an interleaved bufferView as a single vertex buffer with per attribute offsets, defaults to false
+        static constexpr const char* load_nodes = "load_nodes";                               /// std::string, comma separated names or indices of the nodes to load, ancestors are kept as transforms, all other nodes are skipped
+        static constexpr const char* load_scene = "load_scene";                               /// std::string, name or index of the scene to load, or "default" for the glTF's default scene, defaults to loading all scenes
+        static constexpr const char* maxAnisotropy = "maxAnisotropy";                         /// float, default setting of vsg::Sampler::maxAnisotropy to use.
+        static constexpr const char* memory_map = "memory_map";                               /// bool, memory map .glb files and external .bin buffers so binary data is used in place rather than copied, defaults to false
+        static constexpr const char* merge_geometry = "merge_geometry";                       /// bool, bake transforms of static nodes into their vertices and merge primitives that share materials into combined draw calls, defaults to false
+        static constexpr const char* optimize_indices = "optimize_indices";                   /// bool, reorder triangle indices and vertices for post-transform vertex cache and vertex fetch efficiency, defaults to false
+        static constexpr const char* packed_joints = "packed_joints";                         /// bool, pack the joint indices and weights of skinned meshes into 8/16 bit per component vertex arrays, defaults to false
+        static constexpr const char* parallel_build = "parallel_build";                       /// bool, build accessors, materials and meshes in parallel using vsg::Options::operationThreads, defaults to false
+        static constexpr const char* probe = "probe";                                         /// bool, return a gltf::Summary of the content computed from the JSON and image headers rather than building the scene graph, defaults to false
+        static constexpr const char* quantized_attributes = "quantized_attributes";           /// bool, keep KHR_mesh_quantization attributes quantized using normalized/scaled vertex formats rather than converting to float, defaults to false
+        static constexpr const char* share_accessors = "share_accessors";                     /// bool, share byte identical accessor data between loads that use the same vsg::Options::sharedObjects, matched by content hash, defaults to false
+        static constexpr const char* share_images = "share_images";                           /// bool, share images decoded from byte identical embedded image data between loads that use the same vsg::Options::sharedObjects, defaults to false
+        static constexpr const char* skip_animations = "skip_animations";                     /// bool, don't load animations, defaults to false
+        static constexpr const char* skip_cameras = "skip_cameras";                           /// bool, don't load cameras, defaults to false
+        static constexpr const char* skip_lights = "skip_lights";                             /// bool, don't load KHR_lights_punctual lights, defaults to false
+        static constexpr const char* skip_textures = "skip_textures";                         /// bool, don't load textures or the images they use, defaults to false
+        static constexpr const char* prototype_builder = "gltf::Builder";                     /// gltf::Builder prototype cloned for converting gltf::glTF hierachy into VSG scene graph
 
         bool readOptions(vsg::Options& options, vsg::CommandLine& arguments) const override;
 
@@ -183,6 +219,9 @@ namespace vsgXchange
             vsg::ValuesSchema<double> min;
             vsg::ref_ptr<Sparse> sparse;
 
+            // decoded data, e.g. from draco compressed primitives, used in place of the bufferView when set
+            vsg::ref_ptr<vsg::Data> data;
+
             DataProperties getDataProperties() const;
 
             void report(vsg::LogOutput& output);
@@ -266,6 +305,17 @@ namespace vsgXchange
             void read_number(vsg::JSONParser& parser, const std::string_view& property, std::istream& input) override;
         };
 
+        /// KTX2 image with Basis Universal supercompression used in place of the texture's source : https://github.com/KhronosGroup/glTF/tree/main/extensions/2.0/Khronos/KHR_texture_basisu
+        struct VSGXCHANGE_DECLSPEC KHR_texture_basisu : public vsg::Inherit<ExtensionsExtras, KHR_texture_basisu>
+        {
+            glTFid source;
+
+            // extention prototype will be cloned when it's used.
+            vsg::ref_ptr<vsg::Object> clone(const vsg::CopyOp&) const override { return KHR_texture_basisu::create(*this); }
+
+            void read_number(vsg::JSONParser& parser, const std::string_view& property, std::istream& input) override;
+        };
+
         struct VSGXCHANGE_DECLSPEC PbrMetallicRoughness : public vsg::Inherit<ExtensionsExtras, PbrMetallicRoughness>
         {
             vsg::ValuesSchema<float> baseColorFactor; // default { 1.0, 1.0, 1.0, 1.0 }
@@ -452,6 +502,31 @@ namespace vsgXchange
             void read_number(vsg::JSONParser& parser, const std::string_view& property, std::istream& input) override;
         };
 
+        /// https://github.com/KhronosGroup/glTF/blob/main/extensions/2.0/Vendor/EXT_meshopt_compression/README.md
+        /// used on both BufferView, to specify the compressed data, and Buffer, to mark fallback buffers.
+        struct VSGXCHANGE_DECLSPEC EXT_meshopt_compression : public vsg::Inherit<ExtensionsExtras, EXT_meshopt_compression>
+        {
+            // BufferView properties
+            glTFid buffer;
+            uint32_t byteOffset = 0;
+            uint32_t byteLength = 0;
+            uint32_t byteStride = 0;
+            uint32_t count = 0;
+            std::string mode;
+            std::string filter = "NONE";
+
+            // Buffer properties
+            bool fallback = false;
+
+            // extention prototype will be cloned when it's used.
+            vsg::ref_ptr<vsg::Object> clone(const vsg::CopyOp&) const override { return EXT_meshopt_compression::create(*this); }
+
+            void report(vsg::LogOutput& output);
+            void read_string(vsg::JSONParser& parser, const std::string_view& property) override;
+            void read_number(vsg::JSONParser& parser, const std::string_view& property, std::istream& input) override;
+            void read_bool(vsg::JSONParser& parser, const std::string_view& property, bool value) override;
+        };
+
         /// https://github.com/KhronosGroup/glTF/blob/main/extensions/2.0/Vendor/EXT_mesh_gpu_instancing/README.md
         struct VSGXCHANGE_DECLSPEC EXT_mesh_gpu_instancing : public vsg::Inherit<ExtensionsExtras, EXT_mesh_gpu_instancing>
         {
@@ -637,9 +712,40 @@ namespace vsgXchange
 
             void report(vsg::LogOutput& output);
 
+            /// release the objects not required by the scenes/nodes selected by the gltf::load_scene and gltf::load_nodes options, or disabled by the gltf::skip_* options,
+            /// leaving null entries so that the remaining glTFid's stay valid. Called before resolveURIs() so released buffers and images aren't read.
+            virtual void prune(vsg::ref_ptr<const vsg::Options> options);
+
             virtual void resolveURIs(vsg::ref_ptr<const vsg::Options> options);
         };
 
+        /// lightweight summary of glTF content returned by read() when the gltf::probe option is set.
+        class VSGXCHANGE_DECLSPEC Summary : public vsg::Inherit<vsg::Object, Summary>
+        {
+        public:
+            struct Image
+            {
+                std::string uri;  // uri of external images, mimeType of embedded images
+                uint32_t width = 0;
+                uint32_t height = 0; // width and height are 0 when the image header couldn't be read
+            };
+
+            vsg::dbox bounds;            // POSITION accessor min/max transformed by the node hierarchy
+            uint32_t nodeCount = 0;
+            uint32_t meshCount = 0;
+            uint64_t primitiveCount = 0; // primitive, vertex and triangle counts include each instance of a mesh
+            uint64_t vertexCount = 0;
+            uint64_t triangleCount = 0;
+            uint64_t bufferBytes = 0; // sum of the byteLength of all buffers
+            std::vector<Image> images;
+
+            /// expand bounds to include box transformed by matrix.
+            void addBounds(const vsg::dbox& box, const vsg::dmat4& matrix);
+
+            /// accumulate another summary, transforming its bounds by matrix and multiplying its counts by instances.
+            void add(const Summary& summary, const vsg::dmat4& matrix = {}, uint64_t instances = 1);
+        };
+
         class VSGXCHANGE_DECLSPEC Builder : public vsg::Inherit<vsg::Object, Builder>
         {
         public:
@@ -659,6 +765,22 @@ namespace vsgXchange
             vsg::CoordinateConvention source_coordinateConvention = vsg::CoordinateConvention::Y_UP;
             int instanceNodeHint = vsg::Options::INSTANCE_NONE;
             bool cloneAccessors = false;
+            bool compactBuffers = false;
+            bool compressVertices = false;
+            uint32_t clusterSize = 0;
+            bool parallelBuild = false;
+            bool quantizedAttributes = false;
+            bool optimizeIndices = false;
+            bool flattenStaticTransforms = false;
+            uint32_t instanceThreshold = 0;
+            bool interleavedVertices = false;
+            bool packedJoints = false;
+            float animationSampleRate = 0.0f;
+            float animationTolerance = 0.0f;
+            bool mergeGeometry = false;
+            bool shareAccessors = false;
+            bool shareImages = false;
+            bool culling = true;
             float maxAnisotropy = 16.0f;
 
             vsg::ref_ptr<glTF> model;
@@ -673,6 +795,23 @@ namespace vsgXchange
             std::vector<SamplerImage> vsg_textures;
             std::vector<vsg::ref_ptr<vsg::DescriptorConfigurator>> vsg_materials;
             std::vector<vsg::ref_ptr<vsg::Node>> vsg_meshes;
+            std::map<std::pair<uint32_t, uint32_t>, std::pair<vsg::ref_ptr<vsg::Data>, vsg::ref_ptr<vsg::Data>>> vsg_packedJoints;
+            std::vector<vsg::ref_ptr<vsg::Data>> vsg_compressedAccessors;
+
+            struct InstancedMesh
+            {
+                glTFid node;
+                glTFid mesh;
+                vsg::ref_ptr<vsg::vec3Array> translations;
+                vsg::ref_ptr<vsg::quatArray> rotations;
+                vsg::ref_ptr<vsg::vec3Array> scales;
+                vsg::dbox bounds;
+            };
+            std::vector<InstancedMesh> instancedMeshes;
+
+            // draco meshes decoded concurrently by createSceneGraph(), only held until decodePrimitiveIfRequired() has used them.
+            std::map<const gltf::Primitive*, vsg::ref_ptr<vsg::Object>> decodedDracoMeshes;
+
             std::vector<vsg::ref_ptr<vsg::Light>> vsg_lights;
             std::vector<vsg::ref_ptr<vsg::Node>> vsg_nodes;
             std::vector<vsg::ref_ptr<vsg::Node>> vsg_scenes;
@@ -683,6 +822,7 @@ namespace vsgXchange
             {
                 vsg::ref_ptr<gltf::Attributes> instancedAttributes;
                 vsg::ref_ptr<vsg::JointSampler> jointSampler;
+                bool instanceNode = false;
             };
 
             vsg::ref_ptr<vsg::DescriptorConfigurator> default_material;
@@ -694,15 +834,33 @@ namespace vsgXchange
             virtual void assign_name_extras(NameExtensionsExtras& src, vsg::Object& dest);
 
             virtual bool decodePrimitiveIfRequired(vsg::ref_ptr<gltf::Primitive> gltf_primitive);
+            virtual bool decodeBufferViewIfRequired(vsg::ref_ptr<gltf::BufferView> gltf_bufferView);
 
             virtual void flattenTransforms(gltf::Node& node, const vsg::dmat4& transform);
+            virtual void bakeStaticTransforms();
+            virtual void mergeStaticGeometry();
+            virtual void instanceSharedMeshes();
+            virtual void compactAccessors();
+            virtual void releaseBuffers();
+            virtual void compressAccessors();
 
             virtual bool getTransform(gltf::Node& node, vsg::dmat4& transform);
 
             virtual vsg::ref_ptr<vsg::Data> createBuffer(vsg::ref_ptr<gltf::Buffer> gltf_buffer);
             virtual vsg::ref_ptr<vsg::Data> createBufferView(vsg::ref_ptr<gltf::BufferView> gltf_bufferView);
             virtual vsg::ref_ptr<vsg::Data> createArray(const std::string& type, uint32_t componentType, glTFid bufferView, uint32_t offset, uint32_t count);
+            virtual vsg::ref_ptr<vsg::Data> allocateArray(const std::string& type, uint32_t componentType, uint32_t count);
             virtual vsg::ref_ptr<vsg::Data> createAccessor(vsg::ref_ptr<gltf::Accessor> gltf_accessor);
+            virtual vsg::ref_ptr<vsg::Data> dequantize(vsg::ref_ptr<vsg::Data> array, bool normalized);
+            virtual vsg::ref_ptr<vsg::Data> assignQuantizedFormat(vsg::ref_ptr<vsg::Data> array, bool normalized, bool allowPadding);
+            virtual bool getBounds(const gltf::Accessor& gltf_accessor, vsg::dbox& bounds);
+            virtual bool getPrimitiveBounds(const gltf::Primitive& gltf_primitive, vsg::dbox& bounds);
+            virtual bool getMeshBounds(const gltf::Mesh& gltf_mesh, vsg::dbox& bounds);
+            virtual bool getInstancedBounds(const gltf::Attributes& instancedAttributes, vsg::dbox& bounds);
+            virtual bool getNodeBounds(uint32_t nodeID, const vsg::dmat4& transform, vsg::dbox& bounds, std::vector<bool>& visited);
+            virtual vsg::ref_ptr<vsg::Data> processIndices(vsg::ref_ptr<vsg::Data> indices, uint32_t mode, vsg::DataList& vertexArrays, const std::vector<size_t>& perVertexArrays);
+            virtual void interleaveArrays(vsg::GraphicsPipelineConfigurator& config, vsg::DataList& vertexArrays, const std::vector<size_t>& perVertexArrays);
+            virtual vsg::ref_ptr<vsg::Node> createClusters(vsg::ref_ptr<vsg::Data> indices, const vsg::DataList& vertexArrays);
             virtual vsg::ref_ptr<vsg::Camera> createCamera(vsg::ref_ptr<gltf::Camera> gltf_camera);
             virtual vsg::ref_ptr<vsg::Sampler> createSampler(vsg::ref_ptr<gltf::Sampler> gltf_sampler);
             virtual vsg::ref_ptr<vsg::Data> createImage(vsg::ref_ptr<gltf::Image> gltf_image);
@@ -719,7 +877,13 @@ namespace vsgXchange
             virtual vsg::ref_ptr<vsg::ShaderSet> getOrCreatePbrShaderSet();
             virtual vsg::ref_ptr<vsg::ShaderSet> getOrCreateFlatShaderSet();
 
+            /// call func(i) for i in [0, count), distributing the calls across options->operationThreads when parallel is true, returning when all calls have completed.
+            virtual void runInParallel(size_t count, const std::function<void(size_t)>& func, bool parallel);
+
             virtual vsg::ref_ptr<vsg::Object> createSceneGraph(vsg::ref_ptr<gltf::glTF> in_model, vsg::ref_ptr<const vsg::Options> in_options);
+
+            /// create a Summary of the model without reading its buffers or decoding its images, only the image headers are read.
+            virtual vsg::ref_ptr<Summary> createSummary(vsg::ref_ptr<gltf::glTF> in_model, vsg::ref_ptr<const vsg::Options> in_options);
         };
 
         static vsg::Path decodeURI(const std::string_view& uri);
@@ -730,6 +894,13 @@ namespace vsgXchange
         /// function for mapping a mimeType to .extension that can be used with vsgXchange's plugins.
         static vsg::Path mimeTypeToExtension(const std::string_view& mimeType);
 
+        /// function for reading the width and height from the header of png, jpeg, gif, bmp, dds, ktx and ktx2 image data, returns false if the format isn't recognized.
+        static bool imageDimensions(const uint8_t* ptr, size_t size, uint32_t& width, uint32_t& height);
+
+        /// function for decoding base64 encoded data into dest, decoding at most destSize bytes and zero filling any remaining bytes.
+        /// Uses SSE4.1/AVX2 when supported by the CPU, and splits large inputs into chunks decoded in parallel when operationThreads are provided.
+        static void decodeBase64(const std::string_view& encoded, uint8_t* dest, size_t destSize, vsg::ref_ptr<vsg::OperationThreads> operationThreads = {});
+
         virtual void assignExtensions(vsg::JSONParser& parser) const;
     };
 
@@ -755,3 +926,4 @@ namespace vsgXchange
 EVSG_type_name(vsgXchange::gltf)
 EVSG_type_name(vsgXchange::gltf::glTF)
 EVSG_type_name(vsgXchange::gltf::Builder)
+EVSG_type_name(vsgXchange::gltf::Summary)
@@ -31,6 +31,33 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 namespace vsgXchange
 {
+    /// GPU format that supercompressed (Basis Universal) KTX2 textures are transcoded to when read.
+    enum class TranscodeFormat
+    {
+        bc,   /// BC4 R, BC5 RG, BC1 RGB, BC7 RGBA
+        etc,  /// EAC R11, EAC RG11, ETC1 RGB, ETC2 RGBA
+        astc, /// ASTC 4x4 RGBA
+        rgba  /// uncompressed 8bit RGBA
+    };
+
+    // this needs to be defined before 'vsg/commandline.h' has been included
+    inline std::istream& operator>>(std::istream& is, TranscodeFormat& transcodeFormat)
+    {
+        std::string value;
+        is >> value;
+
+        if (value == "etc")
+            transcodeFormat = TranscodeFormat::etc;
+        else if (value == "astc")
+            transcodeFormat = TranscodeFormat::astc;
+        else if ((value == "rgba") || (value == "rgba32"))
+            transcodeFormat = TranscodeFormat::rgba;
+        else
+            transcodeFormat = TranscodeFormat::bc;
+
+        return is;
+    }
+
     /// Composite ReaderWriter that holds the used 3rd party image format loaders.
     /// By default utilizes the stbi, dds and ktx ReaderWriters so that users only need to create vsgXchange::images::create() to utilize them all.
     class VSGXCHANGE_DECLSPEC images : public vsg::Inherit<vsg::CompositeReaderWriter, images>
@@ -96,6 +123,11 @@ namespace vsgXchange
 
         bool getFeatures(Features& features) const override;
 
+        // vsg::Options::setValue(str, value) supported options:
+        static constexpr const char* transcode_format = "transcode_format"; /// TranscodeFormat enum, GPU block format that Basis Universal KTX2 textures are transcoded to, defaults to bc.
+
+        bool readOptions(vsg::Options& options, vsg::CommandLine& arguments) const override;
+
     private:
         ~ktx();
 
@@ -129,3 +161,4 @@ EVSG_type_name(vsgXchange::stbi);
 EVSG_type_name(vsgXchange::dds);
 EVSG_type_name(vsgXchange::ktx);
 EVSG_type_name(vsgXchange::openexr);
+EVSG_type_name(vsgXchange::TranscodeFormat)
@@ -888,6 +888,7 @@ bool Tiles3D::readOptions(vsg::Options& options, vsg::CommandLine& arguments) co
     result = arguments.readAndAssign<bool>(Tiles3D::instancing, &options) | result;
     result = arguments.readAndAssign<double>(Tiles3D::pixel_ratio, &options) | result;
     result = arguments.readAndAssign<uint32_t>(Tiles3D::pre_load_level, &options) | result;
+    result = arguments.readAndAssign<bool>(Tiles3D::probe, &options) | result;
     return result;
 }
 
@@ -905,6 +906,7 @@ bool Tiles3D::getFeatures(Features& features) const
     features.optionNameTypeMap[Tiles3D::instancing] = vsg::type_name<bool>();
     features.optionNameTypeMap[Tiles3D::pixel_ratio] = vsg::type_name<double>();
     features.optionNameTypeMap[Tiles3D::pre_load_level] = vsg::type_name<uint32_t>();
+    features.optionNameTypeMap[Tiles3D::probe] = vsg::type_name<bool>();
 
     return true;
 }
@@ -179,6 +179,20 @@ vsg::ref_ptr<vsg::Object> Tiles3D::read_b3dm(std::istream& fin, vsg::ref_ptr<con
     auto opt = vsg::clone(options);
     opt->extensionHint = ".glb";
 
+    if (vsg::value<bool>(false, Tiles3D::probe, options))
+    {
+        auto summary = vsg::read_cast<gltf::Summary>(binary_fin, opt);
+        if (summary && featureTable && featureTable->RTC_CENTER && featureTable->RTC_CENTER.values.size() == 3)
+        {
+            vsg::dvec3 rtc_center(featureTable->RTC_CENTER.values[0], featureTable->RTC_CENTER.values[1], featureTable->RTC_CENTER.values[2]);
+
+            auto translated = gltf::Summary::create();
+            translated->add(*summary, vsg::translate(rtc_center));
+            summary = translated;
+        }
+        return summary;
+    }
+
     auto model = vsg::read_cast<vsg::Node>(binary_fin, opt);
 
     if (featureTable && featureTable->RTC_CENTER && featureTable->RTC_CENTER.values.size() == 3)
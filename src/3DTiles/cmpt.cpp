@@ -71,6 +71,9 @@ vsg::ref_ptr<vsg::Object> Tiles3D::read_cmpt(std::istream& fin, vsg::ref_ptr<con
         return {};
     }
 
+    bool probe = vsg::value<bool>(false, Tiles3D::probe, options);
+    auto summary = probe ? gltf::Summary::create() : vsg::ref_ptr<gltf::Summary>();
+
     auto group = vsg::Group::create();
     std::list<InnerHeader> innerHeaders;
     uint32_t pos = 0;
@@ -101,7 +104,11 @@ vsg::ref_ptr<vsg::Object> Tiles3D::read_cmpt(std::istream& fin, vsg::ref_ptr<con
         opt->formatCoordinateConventions[".glb"] = upAxis;
 #endif
 
-        if (auto model = vsg::read_cast<vsg::Node>(binary_fin, opt))
+        if (probe)
+        {
+            if (auto tileSummary = vsg::read_cast<gltf::Summary>(binary_fin, opt)) summary->add(*tileSummary);
+        }
+        else if (auto model = vsg::read_cast<vsg::Node>(binary_fin, opt))
         {
             group->addChild(model);
         }
@@ -124,6 +131,8 @@ vsg::ref_ptr<vsg::Object> Tiles3D::read_cmpt(std::istream& fin, vsg::ref_ptr<con
         }
     }
 
+    if (probe) return summary;
+
     vsg::ref_ptr<vsg::Node> model;
 
     if (group->children.size() == 1)
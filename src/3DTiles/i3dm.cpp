@@ -375,6 +375,43 @@ vsg::ref_ptr<vsg::Object> Tiles3D::read_i3dm(std::istream& fin, vsg::ref_ptr<con
         opt->instanceNodeHint = vsg::Options::INSTANCE_TRANSLATIONS | vsg::Options::INSTANCE_ROTATIONS | vsg::Options::INSTANCE_SCALES;
     }
 
+    if (vsg::value<bool>(false, Tiles3D::probe, options))
+    {
+        vsg::ref_ptr<gltf::Summary> child;
+        std::string field;
+        field.resize(size_of_gltfField);
+        fin.read(field.data(), size_of_gltfField);
+
+        if (header.gltfFormat == 0)
+        {
+            while (!field.empty() && field.back() <= 32) field.pop_back();
+            child = vsg::read_cast<gltf::Summary>(field, opt);
+        }
+        else
+        {
+            vsg::mem_stream binary_fin(reinterpret_cast<uint8_t*>(field.data()), field.size());
+            child = vsg::read_cast<gltf::Summary>(binary_fin, opt);
+        }
+
+        if (!child) return {};
+
+        // counts are multiplied by the number of instances, bounds expanded to include each instance.
+        auto summary = gltf::Summary::create();
+        for (uint32_t i = 0; i < featureTable->INSTANCES_LENGTH; ++i)
+        {
+            vsg::dvec3 translation, scale;
+            vsg::dquat rotation;
+            featureTable->getTransformComponents(i, translation, rotation, scale);
+
+            auto matrix = vsg::translate(featureTable->rtc_center + translation) * vsg::rotate(rotation) * vsg::scale(scale);
+            if (i == 0)
+                summary->add(*child, matrix, featureTable->INSTANCES_LENGTH);
+            else
+                summary->addBounds(child->bounds, matrix);
+        }
+        return summary;
+    }
+
     vsg::ref_ptr<vsg::Node> child;
     if (header.gltfFormat == 0)
     {
@@ -0,0 +1,327 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsgXchange/DataCache.h>
+#include <vsgXchange/images.h>
+
+#include <vsg/core/Array.h>
+#include <vsg/io/read.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <iterator>
+#include <typeinfo>
+
+using namespace vsgXchange;
+
+namespace
+{
+    inline uint64_t rotl64(uint64_t x, int8_t r)
+    {
+        return (x << r) | (x >> (64 - r));
+    }
+
+    inline uint64_t fmix64(uint64_t k)
+    {
+        k ^= k >> 33;
+        k *= 0xff51afd7ed558ccdULL;
+        k ^= k >> 33;
+        k *= 0xc4ceb9fe1a85ec53ULL;
+        k ^= k >> 33;
+        return k;
+    }
+
+    inline uint64_t getblock64(const uint8_t* p)
+    {
+        uint64_t v;
+        std::memcpy(&v, p, sizeof(v));
+        return v;
+    }
+} // namespace
+
+DataHash vsgXchange::hash(const void* ptr, size_t size, uint64_t seed)
+{
+    // MurmurHash3_x64_128, Austin Appleby, placed in the public domain.
+    const uint8_t* data = static_cast<const uint8_t*>(ptr);
+    const size_t nblocks = size / 16;
+
+    uint64_t h1 = seed;
+    uint64_t h2 = seed;
+
+    const uint64_t c1 = 0x87c37b91114253d5ULL;
+    const uint64_t c2 = 0x4cf5ad432745937fULL;
+
+    for (size_t i = 0; i < nblocks; ++i)
+    {
+        uint64_t k1 = getblock64(data + i * 16);
+        uint64_t k2 = getblock64(data + i * 16 + 8);
+
+        k1 *= c1;
+        k1 = rotl64(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+
+        h1 = rotl64(h1, 27);
+        h1 += h2;
+        h1 = h1 * 5 + 0x52dce729;
+
+        k2 *= c2;
+        k2 = rotl64(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+
+        h2 = rotl64(h2, 31);
+        h2 += h1;
+        h2 = h2 * 5 + 0x38495ab5;
+    }
+
+    const uint8_t* tail = data + nblocks * 16;
+
+    uint64_t k1 = 0;
+    uint64_t k2 = 0;
+
+    switch (size & 15)
+    {
+    case 15: k2 ^= static_cast<uint64_t>(tail[14]) << 48; [[fallthrough]];
+    case 14: k2 ^= static_cast<uint64_t>(tail[13]) << 40; [[fallthrough]];
+    case 13: k2 ^= static_cast<uint64_t>(tail[12]) << 32; [[fallthrough]];
+    case 12: k2 ^= static_cast<uint64_t>(tail[11]) << 24; [[fallthrough]];
+    case 11: k2 ^= static_cast<uint64_t>(tail[10]) << 16; [[fallthrough]];
+    case 10: k2 ^= static_cast<uint64_t>(tail[9]) << 8; [[fallthrough]];
+    case 9:
+        k2 ^= static_cast<uint64_t>(tail[8]);
+        k2 *= c2;
+        k2 = rotl64(k2, 33);
+        k2 *= c1;
+        h2 ^= k2;
+        [[fallthrough]];
+    case 8: k1 ^= static_cast<uint64_t>(tail[7]) << 56; [[fallthrough]];
+    case 7: k1 ^= static_cast<uint64_t>(tail[6]) << 48; [[fallthrough]];
+    case 6: k1 ^= static_cast<uint64_t>(tail[5]) << 40; [[fallthrough]];
+    case 5: k1 ^= static_cast<uint64_t>(tail[4]) << 32; [[fallthrough]];
+    case 4: k1 ^= static_cast<uint64_t>(tail[3]) << 24; [[fallthrough]];
+    case 3: k1 ^= static_cast<uint64_t>(tail[2]) << 16; [[fallthrough]];
+    case 2: k1 ^= static_cast<uint64_t>(tail[1]) << 8; [[fallthrough]];
+    case 1:
+        k1 ^= static_cast<uint64_t>(tail[0]);
+        k1 *= c1;
+        k1 = rotl64(k1, 31);
+        k1 *= c2;
+        h1 ^= k1;
+        break;
+    default: break;
+    }
+
+    h1 ^= static_cast<uint64_t>(size);
+    h2 ^= static_cast<uint64_t>(size);
+
+    h1 += h2;
+    h2 += h1;
+
+    h1 = fmix64(h1);
+    h2 = fmix64(h2);
+
+    h1 += h2;
+    h2 += h1;
+
+    return DataHash{h1, h2};
+}
+
+DataCache::DataCache()
+{
+}
+
+DataCache::~DataCache()
+{
+}
+
+vsg::ref_ptr<vsg::Data> DataCache::share(vsg::ref_ptr<vsg::Data> data)
+{
+    if (!data || data->valueCount() == 0) return data;
+
+    // views into interleaved buffers aren't contiguous so need copying before their contents can be hashed.
+    if (data->properties.stride != data->valueSize())
+    {
+        data = vsg::clone(data);
+        if (!data || data->properties.stride != data->valueSize()) return data;
+    }
+
+    size_t size = data->valueCount() * data->valueSize();
+    auto key = hash(data->dataPointer(), size, data->properties.format);
+
+    auto matches = [&](const vsg::Data& cached) {
+        return typeid(cached) == typeid(*data) &&
+               cached.properties.format == data->properties.format &&
+               cached.valueCount() == data->valueCount() &&
+               std::memcmp(cached.dataPointer(), data->dataPointer(), size) == 0;
+    };
+
+    {
+        std::scoped_lock<std::mutex> lock(_mutex);
+        if (auto itr = _entries.find(key); itr != _entries.end())
+        {
+            for (auto& cached : itr->second)
+            {
+                if (matches(*cached))
+                {
+                    ++_hits;
+                    return cached;
+                }
+            }
+        }
+    }
+
+    // cache a standalone copy so it doesn't keep the source buffer, or other loads' data, alive.
+    auto copy = vsg::clone(data);
+    if (!copy) return data;
+
+    std::scoped_lock<std::mutex> lock(_mutex);
+
+    // another thread may have added the same data while the copy was being made.
+    auto& entries = _entries[key];
+    for (auto& cached : entries)
+    {
+        if (matches(*cached))
+        {
+            ++_hits;
+            return cached;
+        }
+    }
+
+    entries.push_back(copy);
+    ++_size;
+    _pruneIfRequired();
+    return copy;
+}
+
+vsg::ref_ptr<vsg::Data> DataCache::read(const uint8_t* ptr, size_t size, vsg::ref_ptr<const vsg::Options> options)
+{
+    // the read options that affect the decoded result are folded into the seed.
+    uint64_t seed = 0;
+    if (options)
+    {
+        const auto& extensionHint = options->extensionHint.string();
+        seed = hash(extensionHint.data(), extensionHint.size()).low;
+        if (options->mapRGBtoRGBAHint) seed ^= 1;
+
+        seed ^= static_cast<uint64_t>(vsg::value<TranscodeFormat>(TranscodeFormat::bc, ktx::transcode_format, options)) << 1;
+    }
+
+    auto key = hash(ptr, size, seed);
+
+    std::promise<vsg::ref_ptr<vsg::Data>> promise;
+    std::shared_future<vsg::ref_ptr<vsg::Data>> future;
+    {
+        std::scoped_lock<std::mutex> lock(_mutex);
+        if (auto itr = _encodedEntries.find(key); itr != _encodedEntries.end())
+        {
+            ++_hits;
+            future = itr->second;
+        }
+        else
+        {
+            _encodedEntries[key] = promise.get_future().share();
+        }
+    }
+
+    // another read of the same encoded data has already been made, or is in progress, so use its result.
+    if (future.valid()) return future.get();
+
+    auto data = vsg::read_cast<vsg::Data>(ptr, size, options);
+    promise.set_value(data);
+
+    std::scoped_lock<std::mutex> lock(_mutex);
+    if (data)
+    {
+        ++_size;
+        _pruneIfRequired();
+    }
+    else
+    {
+        _encodedEntries.erase(key); // allow later reads to try again
+    }
+
+    return data;
+}
+
+size_t DataCache::prune()
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return _prune();
+}
+
+size_t DataCache::_prune()
+{
+    // an entry only referenced by the cache is no longer used by any loaded scene graph.
+    size_t released = 0;
+    for (auto itr = _entries.begin(); itr != _entries.end();)
+    {
+        auto& entries = itr->second;
+        auto unused = std::remove_if(entries.begin(), entries.end(), [](const vsg::ref_ptr<vsg::Data>& cached) { return cached->referenceCount() == 1; });
+        released += std::distance(unused, entries.end());
+        entries.erase(unused, entries.end());
+
+        if (entries.empty())
+            itr = _entries.erase(itr);
+        else
+            ++itr;
+    }
+
+    for (auto itr = _encodedEntries.begin(); itr != _encodedEntries.end();)
+    {
+        // reads still in progress are left for a later prune.
+        auto& future = itr->second;
+        if (future.wait_for(std::chrono::seconds(0)) == std::future_status::ready && future.get() && future.get()->referenceCount() == 1)
+        {
+            itr = _encodedEntries.erase(itr);
+            ++released;
+        }
+        else
+        {
+            ++itr;
+        }
+    }
+
+    _size -= std::min(_size, released);
+    return released;
+}
+
+void DataCache::_pruneIfRequired()
+{
+    // prune each time the cache doubles in size so the cost stays proportional to the number of entries added.
+    if (_size < _pruneThreshold) return;
+
+    _prune();
+    _pruneThreshold = std::max(static_cast<size_t>(64), _size * 2);
+}
+
+size_t DataCache::size() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return _size;
+}
+
+size_t DataCache::hits() const
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    return _hits;
+}
+
+void DataCache::clear()
+{
+    std::scoped_lock<std::mutex> lock(_mutex);
+    _entries.clear();
+    _encodedEntries.clear();
+    _size = 0;
+    _pruneThreshold = 64;
+}
@@ -0,0 +1,244 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsgXchange/VertexFormats.h>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <vector>
+
+using namespace vsgXchange;
+
+namespace
+{
+    template<class T>
+    bool readJointIndices(const vsg::Data& data, std::vector<vsg::ivec4>& indices)
+    {
+        auto array = dynamic_cast<const T*>(&data);
+        if (!array) return false;
+
+        indices.reserve(array->size());
+        for (auto& v : *array) indices.emplace_back(static_cast<int32_t>(v[0]), static_cast<int32_t>(v[1]), static_cast<int32_t>(v[2]), static_cast<int32_t>(v[3]));
+        return true;
+    }
+
+    template<class T>
+    bool readJointWeights(const vsg::Data& data, std::vector<vsg::vec4>& weights, float scale)
+    {
+        auto array = dynamic_cast<const T*>(&data);
+        if (!array) return false;
+
+        weights.reserve(array->size());
+        for (auto& v : *array) weights.emplace_back(static_cast<float>(v[0]) * scale, static_cast<float>(v[1]) * scale, static_cast<float>(v[2]) * scale, static_cast<float>(v[3]) * scale);
+        return true;
+    }
+
+    template<class T>
+    vsg::ref_ptr<vsg::Data> packIndices(const std::vector<vsg::ivec4>& indices, VkFormat format)
+    {
+        using value_type = typename T::value_type::value_type;
+
+        auto array = T::create(static_cast<uint32_t>(indices.size()));
+        array->properties.format = format;
+
+        auto dest_itr = array->begin();
+        for (auto& v : indices)
+        {
+            *(dest_itr++) = typename T::value_type(static_cast<value_type>(v[0]), static_cast<value_type>(v[1]), static_cast<value_type>(v[2]), static_cast<value_type>(v[3]));
+        }
+        return array;
+    }
+
+    template<class T>
+    vsg::ref_ptr<vsg::Data> packWeights(const std::vector<vsg::vec4>& weights, VkFormat format, int32_t maxValue)
+    {
+        using value_type = typename T::value_type::value_type;
+
+        auto array = T::create(static_cast<uint32_t>(weights.size()));
+        array->properties.format = format;
+
+        auto dest_itr = array->begin();
+        for (auto& w : weights)
+        {
+            float total = std::max(w[0], 0.0f) + std::max(w[1], 0.0f) + std::max(w[2], 0.0f) + std::max(w[3], 0.0f);
+            float scale = total > 0.0f ? static_cast<float>(maxValue) / total : 0.0f;
+
+            int32_t quantized[4];
+            int32_t sum = 0;
+            int largest = 0;
+            for (int i = 0; i < 4; ++i)
+            {
+                quantized[i] = static_cast<int32_t>(std::lround(std::max(w[i], 0.0f) * scale));
+                sum += quantized[i];
+                if (quantized[i] > quantized[largest]) largest = i;
+            }
+
+            // rounding can leave the quantized weights summing to slightly more or less than 1, so push the error onto the largest weight.
+            if (sum > 0) quantized[largest] = std::clamp(quantized[largest] + (maxValue - sum), 0, maxValue);
+
+            *(dest_itr++) = typename T::value_type(static_cast<value_type>(quantized[0]), static_cast<value_type>(quantized[1]), static_cast<value_type>(quantized[2]), static_cast<value_type>(quantized[3]));
+        }
+        return array;
+    }
+
+    // round to nearest even conversion of a float to an IEEE 754 half float, callers check values are in range.
+    uint16_t floatToHalf(float value)
+    {
+        uint32_t bits = 0;
+        std::memcpy(&bits, &value, sizeof(float));
+
+        uint32_t sign = (bits >> 16) & 0x8000;
+        int32_t exponent = static_cast<int32_t>((bits >> 23) & 0xff) - 127 + 15;
+        uint32_t mantissa = bits & 0x7fffff;
+
+        if (exponent <= 0)
+        {
+            // subnormal half float, or zero when too small to represent.
+            if (exponent < -10) return static_cast<uint16_t>(sign);
+
+            mantissa |= 0x800000;
+            uint32_t shift = static_cast<uint32_t>(14 - exponent);
+            uint32_t half = mantissa >> shift;
+            uint32_t remainder = mantissa & ((1u << shift) - 1);
+            uint32_t halfway = 1u << (shift - 1);
+            if (remainder > halfway || (remainder == halfway && (half & 1))) ++half;
+            return static_cast<uint16_t>(sign | half);
+        }
+
+        if (exponent >= 31) return static_cast<uint16_t>(sign | 0x7c00);
+
+        // rounding up can carry into the exponent which is still the correctly rounded result.
+        uint32_t half = (static_cast<uint32_t>(exponent) << 10) | (mantissa >> 13);
+        uint32_t remainder = mantissa & 0x1fff;
+        if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1))) ++half;
+        return static_cast<uint16_t>(sign | half);
+    }
+
+    template<typename T>
+    T quantize(float value, float scale, float minValue, float maxValue)
+    {
+        return static_cast<T>(std::lround(std::clamp(value, minValue, maxValue) * scale));
+    }
+} // namespace
+
+bool vsgXchange::packJoints(const vsg::Data& jointIndices, const vsg::Data& jointWeights, bool weights16bit, vsg::ref_ptr<vsg::Data>& packedIndices, vsg::ref_ptr<vsg::Data>& packedWeights)
+{
+    std::vector<vsg::ivec4> indices;
+    if (!readJointIndices<vsg::ivec4Array>(jointIndices, indices) &&
+        !readJointIndices<vsg::usvec4Array>(jointIndices, indices) &&
+        !readJointIndices<vsg::ubvec4Array>(jointIndices, indices))
+    {
+        return false;
+    }
+
+    std::vector<vsg::vec4> weights;
+    if (!readJointWeights<vsg::vec4Array>(jointWeights, weights, 1.0f) &&
+        !readJointWeights<vsg::usvec4Array>(jointWeights, weights, 1.0f / 65535.0f) &&
+        !readJointWeights<vsg::ubvec4Array>(jointWeights, weights, 1.0f / 255.0f))
+    {
+        return false;
+    }
+
+    if (indices.size() != weights.size()) return false;
+
+    int32_t minIndex = 0, maxIndex = 0;
+    for (auto& v : indices)
+    {
+        for (int i = 0; i < 4; ++i)
+        {
+            minIndex = std::min(minIndex, v[i]);
+            maxIndex = std::max(maxIndex, v[i]);
+        }
+    }
+
+    // the shader input is a signed ivec4 so the SINT formats are used, limiting indices to 127 and 32767 respectively.
+    if (minIndex < 0 || maxIndex > 32767) return false;
+
+    if (maxIndex <= 127)
+        packedIndices = packIndices<vsg::ubvec4Array>(indices, VK_FORMAT_R8G8B8A8_SINT);
+    else
+        packedIndices = packIndices<vsg::usvec4Array>(indices, VK_FORMAT_R16G16B16A16_SINT);
+
+    if (weights16bit)
+        packedWeights = packWeights<vsg::usvec4Array>(weights, VK_FORMAT_R16G16B16A16_UNORM, 65535);
+    else
+        packedWeights = packWeights<vsg::ubvec4Array>(weights, VK_FORMAT_R8G8B8A8_UNORM, 255);
+
+    return true;
+}
+
+vsg::ref_ptr<vsg::Data> vsgXchange::compressNormals(const vsg::Data& normals)
+{
+    auto src = dynamic_cast<const vsg::vec3Array*>(&normals);
+    if (!src) return {};
+
+    auto array = vsg::svec4Array::create(static_cast<uint32_t>(src->size()));
+    array->properties.format = VK_FORMAT_R16G16B16A16_SNORM;
+
+    auto dest_itr = array->begin();
+    for (auto& n : *src)
+    {
+        *(dest_itr++) = vsg::svec4(quantize<int16_t>(n.x, 32767.0f, -1.0f, 1.0f), quantize<int16_t>(n.y, 32767.0f, -1.0f, 1.0f), quantize<int16_t>(n.z, 32767.0f, -1.0f, 1.0f), 0);
+    }
+    return array;
+}
+
+vsg::ref_ptr<vsg::Data> vsgXchange::compressTexCoords(const vsg::Data& texCoords)
+{
+    auto src = dynamic_cast<const vsg::vec2Array*>(&texCoords);
+    if (!src) return {};
+
+    for (auto& tc : *src)
+    {
+        if (!(std::abs(tc.x) <= 4.0f && std::abs(tc.y) <= 4.0f)) return {};
+    }
+
+    auto array = vsg::usvec2Array::create(static_cast<uint32_t>(src->size()));
+    array->properties.format = VK_FORMAT_R16G16_SFLOAT;
+
+    auto dest_itr = array->begin();
+    for (auto& tc : *src)
+    {
+        *(dest_itr++) = vsg::usvec2(floatToHalf(tc.x), floatToHalf(tc.y));
+    }
+    return array;
+}
+
+vsg::ref_ptr<vsg::Data> vsgXchange::compressColors(const vsg::Data& colors)
+{
+    if (auto src = dynamic_cast<const vsg::vec4Array*>(&colors))
+    {
+        auto array = vsg::ubvec4Array::create(static_cast<uint32_t>(src->size()));
+        array->properties.format = VK_FORMAT_R8G8B8A8_UNORM;
+
+        auto dest_itr = array->begin();
+        for (auto& c : *src)
+        {
+            *(dest_itr++) = vsg::ubvec4(quantize<uint8_t>(c.r, 255.0f, 0.0f, 1.0f), quantize<uint8_t>(c.g, 255.0f, 0.0f, 1.0f), quantize<uint8_t>(c.b, 255.0f, 0.0f, 1.0f), quantize<uint8_t>(c.a, 255.0f, 0.0f, 1.0f));
+        }
+        return array;
+    }
+    else if (auto src3 = dynamic_cast<const vsg::vec3Array*>(&colors))
+    {
+        auto array = vsg::ubvec4Array::create(static_cast<uint32_t>(src3->size()));
+        array->properties.format = VK_FORMAT_R8G8B8A8_UNORM;
+
+        auto dest_itr = array->begin();
+        for (auto& c : *src3)
+        {
+            *(dest_itr++) = vsg::ubvec4(quantize<uint8_t>(c.r, 255.0f, 0.0f, 1.0f), quantize<uint8_t>(c.g, 255.0f, 0.0f, 1.0f), quantize<uint8_t>(c.b, 255.0f, 0.0f, 1.0f), 255);
+        }
+        return array;
+    }
+    return {};
+}
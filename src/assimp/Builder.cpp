@@ -11,6 +11,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 </editor-fold> */
 
 #include <vsg/all.h>
+#include <vsgXchange/DataCache.h>
+#include <vsgXchange/VertexFormats.h>
 #include <vsgXchange/assimp.h>
 
 using namespace vsgXchange;
@@ -470,7 +472,11 @@ assimp::SamplerData assimp::Builder::convertTexture(const aiMaterial& material,
                 // texture is a compressed format, defer to the VSG's vsg::read() to convert the block of data to vsg::Data image.
                 auto imageOptions = vsg::clone(options);
                 imageOptions->extensionHint = vsg::Path(".") + texture->achFormatHint;
-                samplerImage.data = vsg::read_cast<vsg::Data>(reinterpret_cast<const uint8_t*>(texture->pcData), texture->mWidth, imageOptions);
+                auto ptr = reinterpret_cast<const uint8_t*>(texture->pcData);
+                if (shareImages)
+                    samplerImage.data = sharedObjects->shareDefault<DataCache>()->read(ptr, texture->mWidth, imageOptions);
+                else
+                    samplerImage.data = vsg::read_cast<vsg::Data>(ptr, texture->mWidth, imageOptions);
 
                 // if no data assigned return null
                 if (!samplerImage.data) return {};
@@ -900,8 +906,9 @@ void assimp::Builder::convert(const aiMesh* mesh, vsg::ref_ptr<vsg::Node>& node)
 
     if (mesh->mNormals)
     {
-        auto normals = vsg::vec3Array::create(mesh->mNumVertices);
+        vsg::ref_ptr<vsg::Data> normals = vsg::vec3Array::create(mesh->mNumVertices);
         std::memcpy(normals->dataPointer(), mesh->mNormals, mesh->mNumVertices * 12);
+        if (compressVertices) normals = compressNormals(*normals);
         config->assignArray(vertexArrays, "vsg_Normal", VK_VERTEX_INPUT_RATE_VERTEX, normals);
     }
     else
@@ -919,7 +926,13 @@ void assimp::Builder::convert(const aiMesh* mesh, vsg::ref_ptr<vsg::Node>& node)
             auto& tc = src_texcoords[i];
             dest_texcoords->at(i).set(tc[0], tc[1]);
         }
-        config->assignArray(vertexArrays, "vsg_TexCoord0", VK_VERTEX_INPUT_RATE_VERTEX, dest_texcoords);
+
+        vsg::ref_ptr<vsg::Data> texcoords = dest_texcoords;
+        if (compressVertices)
+        {
+            if (auto compressed = compressTexCoords(*dest_texcoords)) texcoords = compressed;
+        }
+        config->assignArray(vertexArrays, "vsg_TexCoord0", VK_VERTEX_INPUT_RATE_VERTEX, texcoords);
     }
     else
     {
@@ -935,7 +948,10 @@ void assimp::Builder::convert(const aiMesh* mesh, vsg::ref_ptr<vsg::Node>& node)
         auto colors = vsg::vec4Array::create(mesh->mNumVertices);
         std::memcpy(colors->dataPointer(), mesh->mColors[0], mesh->mNumVertices * 16);
         vsg::convert(colors->size(), &(colors->at(0)), sourceVertexColorSpace, targetVertexColorSpace);
-        config->assignArray(vertexArrays, "vsg_Color", VK_VERTEX_INPUT_RATE_VERTEX, colors);
+        if (compressVertices)
+            config->assignArray(vertexArrays, "vsg_Color", VK_VERTEX_INPUT_RATE_VERTEX, compressColors(*colors));
+        else
+            config->assignArray(vertexArrays, "vsg_Color", VK_VERTEX_INPUT_RATE_VERTEX, colors);
 
         vsg::debug("vsg::convert(", colors, ", ", sourceVertexColorSpace, ", ", targetVertexColorSpace, ")");
     }
@@ -965,9 +981,6 @@ void assimp::Builder::convert(const aiMesh* mesh, vsg::ref_ptr<vsg::Node>& node)
 
         std::vector<uint32_t> weightCounts(mesh->mNumVertices, 0);
 
-        config->assignArray(vertexArrays, "vsg_JointIndices", VK_VERTEX_INPUT_RATE_VERTEX, jointIndices);
-        config->assignArray(vertexArrays, "vsg_JointWeights", VK_VERTEX_INPUT_RATE_VERTEX, jointWeights);
-
         // vsg::info("\nProcessing bones");
         // vsg::info("mesh->mNumBones = ", mesh->mNumBones);
         // vsg::info("mesh->mNumVertices = ", mesh->mNumVertices);
@@ -1037,6 +1050,18 @@ void assimp::Builder::convert(const aiMesh* mesh, vsg::ref_ptr<vsg::Node>& node)
                 }
             }
         }
+
+        vsg::ref_ptr<vsg::Data> packedIndices, packedWeights;
+        if (packedJoints && packJoints(*jointIndices, *jointWeights, false, packedIndices, packedWeights))
+        {
+            config->assignArray(vertexArrays, "vsg_JointIndices", VK_VERTEX_INPUT_RATE_VERTEX, packedIndices);
+            config->assignArray(vertexArrays, "vsg_JointWeights", VK_VERTEX_INPUT_RATE_VERTEX, packedWeights);
+        }
+        else
+        {
+            config->assignArray(vertexArrays, "vsg_JointIndices", VK_VERTEX_INPUT_RATE_VERTEX, jointIndices);
+            config->assignArray(vertexArrays, "vsg_JointWeights", VK_VERTEX_INPUT_RATE_VERTEX, jointWeights);
+        }
     }
 
     auto vid = vsg::VertexIndexDraw::create();
@@ -1112,6 +1137,9 @@ vsg::ref_ptr<vsg::Node> assimp::Builder::createSceneGraph(const aiScene* in_scen
     externalTextures = vsg::value<bool>(false, assimp::external_textures, options);
     externalTextureFormat = vsg::value<TextureFormat>(TextureFormat::native, assimp::external_texture_format, options);
     culling = vsg::value<bool>(true, assimp::culling, options);
+    shareImages = vsg::value<bool>(false, assimp::share_images, options);
+    packedJoints = vsg::value<bool>(false, assimp::packed_joints, options);
+    compressVertices = vsg::value<bool>(false, assimp::compress_vertices, options);
     topEmptyTransform = {};
 
     if (ext == ".gltf" || ext == ".glb")
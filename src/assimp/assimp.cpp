@@ -92,6 +92,9 @@ bool assimp::getFeatures(Features& features) const
     features.optionNameTypeMap[assimp::culling] = vsg::type_name<bool>();
     features.optionNameTypeMap[assimp::vertex_color_space] = vsg::type_name<vsg::CoordinateSpace>();
     features.optionNameTypeMap[assimp::material_color_space] = vsg::type_name<vsg::CoordinateSpace>();
+    features.optionNameTypeMap[assimp::share_images] = vsg::type_name<bool>();
+    features.optionNameTypeMap[assimp::packed_joints] = vsg::type_name<bool>();
+    features.optionNameTypeMap[assimp::compress_vertices] = vsg::type_name<bool>();
 
     return true;
 }
@@ -109,6 +112,9 @@ bool assimp::readOptions(vsg::Options& options, vsg::CommandLine& arguments) con
     result = arguments.readAndAssign<bool>(assimp::culling, &options) || result;
     result = arguments.readAndAssign<vsg::CoordinateSpace>(assimp::vertex_color_space, &options) || result;
     result = arguments.readAndAssign<vsg::CoordinateSpace>(assimp::material_color_space, &options) || result;
+    result = arguments.readAndAssign<bool>(assimp::share_images, &options) || result;
+    result = arguments.readAndAssign<bool>(assimp::packed_joints, &options) || result;
+    result = arguments.readAndAssign<bool>(assimp::compress_vertices, &options) || result;
 
     return result;
 }
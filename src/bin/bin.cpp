@@ -21,8 +21,98 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 #include <fstream>
 
+#if defined(_WIN32)
+#    ifndef WIN32_LEAN_AND_MEAN
+#        define WIN32_LEAN_AND_MEAN
+#    endif
+#    ifndef NOMINMAX
+#        define NOMINMAX
+#    endif
+#    include <windows.h>
+#else
+#    include <fcntl.h>
+#    include <sys/mman.h>
+#    include <sys/stat.h>
+#    include <unistd.h>
+#endif
+
 using namespace vsgXchange;
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// MappedData
+//
+MappedData::MappedData(const vsg::Path& filename)
+{
+#if defined(_WIN32)
+    HANDLE fileHandle = CreateFileW(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr);
+    if (fileHandle == INVALID_HANDLE_VALUE) return;
+
+    LARGE_INTEGER fileSize;
+    if (GetFileSizeEx(fileHandle, &fileSize) && fileSize.QuadPart > 0)
+    {
+        // PAGE_WRITECOPY/FILE_MAP_COPY provide a private copy-on-write view so the loaders can modify data in place without touching the file
+        HANDLE mappingHandle = CreateFileMappingW(fileHandle, nullptr, PAGE_WRITECOPY, 0, 0, nullptr);
+        if (mappingHandle)
+        {
+            _mappedAddress = MapViewOfFile(mappingHandle, FILE_MAP_COPY, 0, 0, 0);
+            if (_mappedAddress) _mappedSize = static_cast<size_t>(fileSize.QuadPart);
+            CloseHandle(mappingHandle);
+        }
+    }
+    CloseHandle(fileHandle);
+#else
+    int fd = open(filename.c_str(), O_RDONLY);
+    if (fd < 0) return;
+
+    struct stat fileStat;
+    if (fstat(fd, &fileStat) == 0 && fileStat.st_size > 0)
+    {
+        // MAP_PRIVATE provides a copy-on-write view so the loaders can modify data in place without touching the file
+        void* address = mmap(nullptr, static_cast<size_t>(fileStat.st_size), PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+        if (address != MAP_FAILED)
+        {
+            _mappedAddress = address;
+            _mappedSize = static_cast<size_t>(fileStat.st_size);
+        }
+    }
+    close(fd);
+#endif
+
+    if (_mappedAddress)
+    {
+        vsg::Data::Properties props;
+        props.allocatorType = vsg::ALLOCATOR_TYPE_NO_DELETE;
+        assign(_mappedSize, static_cast<uint8_t*>(_mappedAddress), props);
+    }
+}
+
+MappedData::~MappedData()
+{
+    // detach the mapped memory from the ubyteArray before unmapping it
+    dataRelease();
+
+    if (!_mappedAddress) return;
+
+#if defined(_WIN32)
+    UnmapViewOfFile(_mappedAddress);
+#else
+    munmap(_mappedAddress, _mappedSize);
+#endif
+}
+
+vsg::ref_ptr<MappedData> MappedData::create(const vsg::Path& filename)
+{
+    vsg::ref_ptr<MappedData> mapped(new MappedData(filename));
+    if (mapped->_mappedAddress) return mapped;
+    return {};
+}
+
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// bin
+//
+
 bin::bin()
 {
 }
@@ -50,6 +140,14 @@ vsg::ref_ptr<vsg::Object> bin::read(const vsg::Path& filename, vsg::ref_ptr<cons
     vsg::Path filenameToUse = vsg::findFile(filename, options);
     if (!filenameToUse) return {};
 
+    if (vsg::value<bool>(false, bin::memory_map, options))
+    {
+        if (auto mapped = MappedData::create(filenameToUse))
+            return mapped;
+        else
+            vsg::info("bin::read(", filename, ") unable to memory map file, falling back to reading via std::ifstream.");
+    }
+
     std::ifstream fin(filenameToUse, std::ios::ate | std::ios::binary);
     return _read(fin);
 }
@@ -81,5 +179,12 @@ bool bin::getFeatures(Features& features) const
     vsg::ReaderWriter::FeatureMask supported_features = static_cast<vsg::ReaderWriter::FeatureMask>(vsg::ReaderWriter::READ_FILENAME | vsg::ReaderWriter::READ_ISTREAM | vsg::ReaderWriter::READ_MEMORY);
     features.extensionFeatureMap[".bin"] = supported_features;
 
+    features.optionNameTypeMap[bin::memory_map] = vsg::type_name<bool>();
+
     return true;
 }
+
+bool bin::readOptions(vsg::Options& options, vsg::CommandLine& arguments) const
+{
+    return arguments.readAndAssign<bool>(bin::memory_map, &options);
+}
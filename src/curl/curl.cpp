@@ -10,14 +10,18 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsg/io/Options.h>
 #include <vsg/io/read.h>
 #include <vsgXchange/curl.h>
 
 #include <curl/curl.h>
 
+#include <condition_variable>
+#include <deque>
 #include <fstream>
 #include <iostream>
 #include <sstream>
+#include <thread>
 
 using namespace vsgXchange;
 
@@ -57,6 +61,102 @@ namespace vsgXchange
         return {};
     }
 
+    /// std::streambuf filled by the curl write callback on the transfer thread and read by a ReaderWriter on the calling thread,
+    /// underflow() blocks until more data has arrived or the transfer has completed, write() blocks while more than maxQueuedSize
+    /// bytes are waiting to be read so a slow reader doesn't end up holding the whole download in memory.
+    class StreamBuffer : public std::streambuf
+    {
+    public:
+        static constexpr size_t maxQueuedSize = 16 * 1024 * 1024;
+
+        StreamBuffer(CURL* in_curl, std::ostream* in_copy) :
+            _curl(in_curl), _copy(in_copy) {}
+
+        size_t write(const char* ptr, size_t size)
+        {
+            // the body of error responses isn't passed on so the reader just sees an empty stream.
+            long response_code = 0;
+            curl_easy_getinfo(_curl, CURLINFO_RESPONSE_CODE, &response_code);
+            if (response_code >= 200 && response_code < 300)
+            {
+                std::unique_lock<std::mutex> lock(_mutex);
+                _condition.wait(lock, [&]() { return _queuedSize < maxQueuedSize || !_reading; });
+
+                // returning less than size makes curl abort the transfer.
+                if (_aborted) return 0;
+
+                if (_reading)
+                {
+                    _chunks.emplace_back(ptr, size);
+                    _queuedSize += size;
+                }
+                if (_copy) _copy->write(ptr, size);
+                _condition.notify_all();
+            }
+            return size;
+        }
+
+        void close()
+        {
+            std::scoped_lock<std::mutex> lock(_mutex);
+            _closed = true;
+            _condition.notify_all();
+        }
+
+        /// called once the reader has finished with the stream, any remaining data is only passed on to the copy,
+        /// or if abort is true the transfer is stopped.
+        void finishReading(bool abort)
+        {
+            std::scoped_lock<std::mutex> lock(_mutex);
+            _reading = false;
+            _aborted = abort;
+            _chunks.clear();
+            _queuedSize = 0;
+            _condition.notify_all();
+        }
+
+    protected:
+        int_type underflow() override
+        {
+            std::unique_lock<std::mutex> lock(_mutex);
+            _condition.wait(lock, [&]() { return !_chunks.empty() || _closed; });
+            if (_chunks.empty()) return traits_type::eof();
+
+            _current = std::move(_chunks.front());
+            _chunks.pop_front();
+            _queuedSize -= _current.size();
+            _condition.notify_all();
+
+            setg(_current.data(), _current.data(), _current.data() + _current.size());
+            return traits_type::to_int_type(*gptr());
+        }
+
+        CURL* _curl = nullptr;
+        std::ostream* _copy = nullptr;
+        std::mutex _mutex;
+        std::condition_variable _condition;
+        std::deque<std::string> _chunks;
+        std::string _current;
+        size_t _queuedSize = 0;
+        bool _closed = false;
+        bool _reading = true;
+        bool _aborted = false;
+    };
+
+    /// joins the transfer thread when leaving scope, including when the reader throws, so the std::thread is never destroyed while joinable.
+    struct TransferGuard
+    {
+        StreamBuffer& streamBuffer;
+        std::thread& transfer;
+        bool completed = false;
+
+        ~TransferGuard()
+        {
+            streamBuffer.finishReading(!completed);
+            transfer.join();
+        }
+    };
+
     class curl::Implementation
     {
     public:
@@ -139,6 +239,7 @@ bool curl::getFeatures(Features& features) const
     features.protocolFeatureMap["http"] = vsg::ReaderWriter::READ_FILENAME;
     features.protocolFeatureMap["https"] = vsg::ReaderWriter::READ_FILENAME;
     features.optionNameTypeMap[curl::SSL_OPTIONS] = "uint32_t";
+    features.optionNameTypeMap[curl::STREAMING] = "bool";
     return true;
 }
 
@@ -193,6 +294,19 @@ size_t StreamCallback(void* ptr, size_t size, size_t nmemb, void* user_data)
     return realsize;
 }
 
+size_t StreamBufferCallback(void* ptr, size_t size, size_t nmemb, void* user_data)
+{
+    size_t realsize = size * nmemb;
+
+    if (user_data)
+    {
+        auto streamBuffer = reinterpret_cast<StreamBuffer*>(user_data);
+        return streamBuffer->write(reinterpret_cast<const char*>(ptr), realsize);
+    }
+
+    return realsize;
+}
+
 vsg::ref_ptr<vsg::Object> curl::Implementation::read(const vsg::Path& filename, vsg::ref_ptr<const vsg::Options> options) const
 {
     auto _curl = curl_easy_init();
@@ -222,7 +336,43 @@ vsg::ref_ptr<vsg::Object> curl::Implementation::read(const vsg::Path& filename,
 
     vsg::ref_ptr<vsg::Object> object;
 
-    CURLcode result = curl_easy_perform(_curl);
+    auto local_options = vsg::clone(options);
+    local_options->paths.insert(local_options->paths.begin(), vsg::filePath(filename));
+    if (!local_options->extensionHint)
+    {
+        local_options->extensionHint = vsg::lowerCaseFileExtension(filename);
+    }
+
+    // .glb files are read sequentially so can be passed to the reader as they download, overlapping the download with the parsing of the JSON.
+    bool streaming = local_options->extensionHint == ".glb" && vsg::value<bool>(false, curl::STREAMING, options);
+
+    CURLcode result = CURLE_OK;
+    if (streaming)
+    {
+        // the stringstream is only filled when it's required for writing to the file cache.
+        StreamBuffer streamBuffer(_curl, (options && options->fileCache) ? &sstr : nullptr);
+        curl_easy_setopt(_curl, CURLOPT_WRITEFUNCTION, StreamBufferCallback);
+        curl_easy_setopt(_curl, CURLOPT_WRITEDATA, (void*)&streamBuffer);
+
+        std::thread transfer([&]() {
+            result = curl_easy_perform(_curl);
+            streamBuffer.close();
+        });
+
+        {
+            TransferGuard guard{streamBuffer, transfer};
+
+            std::istream fin(&streamBuffer);
+            object = vsg::read(fin, local_options);
+
+            guard.completed = true;
+        }
+    }
+    else
+    {
+        result = curl_easy_perform(_curl);
+    }
+
     if (result == 0)
     {
         // https://developer.mozilla.org/en-US/docs/Web/HTTP/Status
@@ -232,14 +382,7 @@ vsg::ref_ptr<vsg::Object> curl::Implementation::read(const vsg::Path& filename,
         if (result == 0 && response_code >= 200 && response_code < 300) // successful responses.
         {
             // success
-            auto local_options = vsg::clone(options);
-            local_options->paths.insert(local_options->paths.begin(), vsg::filePath(filename));
-            if (!local_options->extensionHint)
-            {
-                local_options->extensionHint = vsg::lowerCaseFileExtension(filename);
-            }
-
-            object = vsg::read(sstr, local_options);
+            if (!streaming) object = vsg::read(sstr, local_options);
 
             if (object && options->fileCache)
             {
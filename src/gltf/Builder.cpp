@@ -21,12 +21,17 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 
 </editor-fold> */
 
+#include <vsgXchange/DataCache.h>
+#include <vsgXchange/VertexFormats.h>
 #include <vsgXchange/gltf.h>
 
 #include <vsg/animation/AnimationGroup.h>
 #include <vsg/animation/Joint.h>
 #include <vsg/animation/JointSampler.h>
 #include <vsg/animation/TransformSampler.h>
+#include <vsg/commands/BindIndexBuffer.h>
+#include <vsg/commands/BindVertexBuffers.h>
+#include <vsg/commands/DrawIndexed.h>
 #include <vsg/lighting/DirectionalLight.h>
 #include <vsg/lighting/PointLight.h>
 #include <vsg/lighting/SpotLight.h>
@@ -37,6 +42,7 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <vsg/nodes/Group.h>
 #include <vsg/nodes/InstanceDraw.h>
 #include <vsg/nodes/InstanceDrawIndexed.h>
+#include <vsg/nodes/InstanceNode.h>
 #include <vsg/nodes/Layer.h>
 #include <vsg/nodes/MatrixTransform.h>
 #include <vsg/nodes/StateGroup.h>
@@ -44,16 +50,29 @@ CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
 #include <vsg/nodes/VertexDraw.h>
 #include <vsg/nodes/VertexIndexDraw.h>
 #include <vsg/state/material.h>
+#include <vsg/threading/Latch.h>
 #include <vsg/utils/ComputeBounds.h>
 #include <vsg/utils/GraphicsPipelineConfigurator.h>
 
+#include <vsg/io/FileSystem.h>
 #include <vsg/io/write.h>
 
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <fstream>
+#include <limits>
+#include <set>
+
 #ifdef vsgXchange_draco
 #    include "draco/compression/decode.h"
 #    include "draco/core/decoder_buffer.h"
 #endif
 
+#ifdef vsgXchange_meshopt
+#    include <meshoptimizer.h>
+#endif
+
 using namespace vsgXchange;
 
 gltf::Builder::Builder()
@@ -273,8 +292,71 @@ vsg::ref_ptr<vsg::Data> gltf::Builder::createArray(const std::string& type, uint
     return vsg_data;
 }
 
+vsg::ref_ptr<vsg::Data> gltf::Builder::allocateArray(const std::string& type, uint32_t componentType, uint32_t count)
+{
+    switch (componentType)
+    {
+    case (COMPONENT_TYPE_BYTE):
+        if (type == "SCALAR") return vsg::byteArray::create(count);
+        if (type == "VEC2") return vsg::bvec2Array::create(count);
+        if (type == "VEC3") return vsg::bvec3Array::create(count);
+        if (type == "VEC4") return vsg::bvec4Array::create(count);
+        break;
+    case (COMPONENT_TYPE_UNSIGNED_BYTE):
+        if (type == "SCALAR") return vsg::ubyteArray::create(count);
+        if (type == "VEC2") return vsg::ubvec2Array::create(count);
+        if (type == "VEC3") return vsg::ubvec3Array::create(count);
+        if (type == "VEC4") return vsg::ubvec4Array::create(count);
+        break;
+    case (COMPONENT_TYPE_SHORT):
+        if (type == "SCALAR") return vsg::shortArray::create(count);
+        if (type == "VEC2") return vsg::svec2Array::create(count);
+        if (type == "VEC3") return vsg::svec3Array::create(count);
+        if (type == "VEC4") return vsg::svec4Array::create(count);
+        break;
+    case (COMPONENT_TYPE_UNSIGNED_SHORT):
+        if (type == "SCALAR") return vsg::ushortArray::create(count);
+        if (type == "VEC2") return vsg::usvec2Array::create(count);
+        if (type == "VEC3") return vsg::usvec3Array::create(count);
+        if (type == "VEC4") return vsg::usvec4Array::create(count);
+        break;
+    case (COMPONENT_TYPE_INT):
+        if (type == "SCALAR") return vsg::intArray::create(count);
+        if (type == "VEC2") return vsg::ivec2Array::create(count);
+        if (type == "VEC3") return vsg::ivec3Array::create(count);
+        if (type == "VEC4") return vsg::ivec4Array::create(count);
+        break;
+    case (COMPONENT_TYPE_UNSIGNED_INT):
+        if (type == "SCALAR") return vsg::uintArray::create(count);
+        if (type == "VEC2") return vsg::uivec2Array::create(count);
+        if (type == "VEC3") return vsg::uivec3Array::create(count);
+        if (type == "VEC4") return vsg::uivec4Array::create(count);
+        break;
+    case (COMPONENT_TYPE_FLOAT):
+        if (type == "SCALAR") return vsg::floatArray::create(count);
+        if (type == "VEC2") return vsg::vec2Array::create(count);
+        if (type == "VEC3") return vsg::vec3Array::create(count);
+        if (type == "VEC4") return vsg::vec4Array::create(count);
+        if (type == "MAT4") return vsg::mat4Array::create(count);
+        break;
+    case (COMPONENT_TYPE_DOUBLE):
+        if (type == "SCALAR") return vsg::doubleArray::create(count);
+        if (type == "VEC2") return vsg::dvec2Array::create(count);
+        if (type == "VEC3") return vsg::dvec3Array::create(count);
+        if (type == "VEC4") return vsg::dvec4Array::create(count);
+        if (type == "MAT4") return vsg::dmat4Array::create(count);
+        break;
+    }
+
+    vsg::warn("Unsupported type = ", type, ", componentType = ", componentType);
+    return {};
+}
+
 vsg::ref_ptr<vsg::Data> gltf::Builder::createAccessor(vsg::ref_ptr<gltf::Accessor> gltf_accessor)
 {
+    // data already decoded, e.g. from draco compressed primitives
+    if (gltf_accessor->data) return gltf_accessor->data;
+
     if (!gltf_accessor->bufferView)
     {
         vsg::info("Warning: no bufferView available to create Accessor.");
@@ -318,6 +400,224 @@ vsg::ref_ptr<vsg::Data> gltf::Builder::createAccessor(vsg::ref_ptr<gltf::Accesso
     return vsg_data;
 }
 
+namespace
+{
+    // copy a 3 component array into a contiguous array with a stride of paddedStride, so it can still be bound with a 4 component vertex format.
+    template<class T>
+    vsg::ref_ptr<vsg::Data> paddedCopy(const vsg::Data& array, uint32_t paddedStride)
+    {
+        auto count = static_cast<uint32_t>(array.valueCount());
+        auto storage = vsg::ubyteArray::create(count * paddedStride);
+        std::memset(storage->dataPointer(), 0, storage->dataSize());
+        for (uint32_t i = 0; i < count; ++i)
+        {
+            std::memcpy(storage->dataPointer(i * paddedStride), array.dataPointer(i), array.valueSize());
+        }
+
+        auto properties = array.properties;
+        properties.stride = paddedStride;
+        return T::create(storage, 0, paddedStride, count, properties);
+    }
+} // namespace
+
+void gltf::Builder::compactAccessors()
+{
+    auto withinBufferView = [](const vsg::Data& data, const vsg::Data& bufferView) {
+        auto begin = static_cast<const uint8_t*>(bufferView.dataPointer());
+        auto ptr = static_cast<const uint8_t*>(data.dataPointer());
+        return ptr >= begin && ptr < begin + bufferView.dataSize();
+    };
+
+    // interleaved attributes are bound from a single vertex buffer so copy the whole of their bufferView rather than each attribute.
+    std::vector<bool> copyBufferView(vsg_bufferViews.size(), false);
+    std::vector<bool> compactAccessor(vsg_accessors.size(), false);
+    for (size_t ai = 0; ai < vsg_accessors.size(); ++ai)
+    {
+        auto& vsg_accessor = vsg_accessors[ai];
+        auto& gltf_accessor = model->accessors.values[ai];
+        if (!vsg_accessor || !gltf_accessor || !gltf_accessor->bufferView) continue;
+
+        // accessors replaced by decoded, baked or merged arrays no longer reference the buffers.
+        auto& vsg_bufferView = vsg_bufferViews[gltf_accessor->bufferView.value];
+        if (!vsg_bufferView || !withinBufferView(*vsg_accessor, *vsg_bufferView)) continue;
+
+        if (interleavedVertices && vsg_accessor->properties.stride > vsg_accessor->valueSize())
+            copyBufferView[gltf_accessor->bufferView.value] = true;
+        else
+            compactAccessor[ai] = true;
+    }
+
+    for (size_t bvi = 0; bvi < vsg_bufferViews.size(); ++bvi)
+    {
+        if (!copyBufferView[bvi]) continue;
+
+        // copy the whole byteLength from the buffer, as a bufferView may end just after its last element rather than on a whole stride,
+        // so the view created by createBufferView() can be shorter than the accessors that read from it.
+        auto& vsg_bufferView = vsg_bufferViews[bvi];
+        auto& gltf_bufferView = model->bufferViews.values[bvi];
+        auto& vsg_buffer = vsg_buffers[gltf_bufferView->buffer.value];
+        if (!vsg_buffer || vsg_buffer->dataSize() < static_cast<size_t>(gltf_bufferView->byteOffset) + gltf_bufferView->byteLength)
+        {
+            vsg::warn("gltf::Builder::compactAccessors() unable to copy bufferView ", bvi, ", its buffer will remain referenced.");
+            copyBufferView[bvi] = false;
+            continue;
+        }
+
+        // copy the bytes directly, an Array copy would only keep the first byte of each stride, and zero pad up to a whole stride.
+        uint32_t stride = vsg_bufferView->properties.stride;
+        uint32_t count = (gltf_bufferView->byteLength + stride - 1) / stride;
+        auto storage = vsg::ubyteArray::create(count * stride);
+        std::memset(storage->dataPointer(), 0, storage->dataSize());
+        std::memcpy(storage->dataPointer(), static_cast<const uint8_t*>(vsg_buffer->dataPointer()) + gltf_bufferView->byteOffset, gltf_bufferView->byteLength);
+
+        vsg_bufferView = vsg::ubyteArray::create(storage, 0, stride, count);
+    }
+
+    for (size_t ai = 0; ai < vsg_accessors.size(); ++ai)
+    {
+        auto& vsg_accessor = vsg_accessors[ai];
+        auto& gltf_accessor = model->accessors.values[ai];
+        if (compactAccessor[ai])
+        {
+            // keep the padding of 3 component 8/16bit attributes that assignQuantizedFormat() binds with 4 component formats.
+            if (quantizedAttributes)
+            {
+                uint32_t stride = vsg_accessor->properties.stride;
+                vsg::ref_ptr<vsg::Data> padded;
+                if (vsg_accessor.cast<vsg::bvec3Array>() && stride >= 4) padded = paddedCopy<vsg::bvec3Array>(*vsg_accessor, 4);
+                else if (vsg_accessor.cast<vsg::ubvec3Array>() && stride >= 4) padded = paddedCopy<vsg::ubvec3Array>(*vsg_accessor, 4);
+                else if (vsg_accessor.cast<vsg::svec3Array>() && stride >= 8) padded = paddedCopy<vsg::svec3Array>(*vsg_accessor, 8);
+                else if (vsg_accessor.cast<vsg::usvec3Array>() && stride >= 8) padded = paddedCopy<vsg::usvec3Array>(*vsg_accessor, 8);
+
+                if (padded)
+                {
+                    vsg_accessor = padded;
+                    continue;
+                }
+            }
+
+            auto compacted = allocateArray(gltf_accessor->type, gltf_accessor->componentType, gltf_accessor->count);
+            if (!compacted || compacted->valueSize() != vsg_accessor->valueSize() || compacted->valueCount() != vsg_accessor->valueCount())
+            {
+                vsg::warn("gltf::Builder::compactAccessors() unable to compact accessor ", ai, ", its buffer will remain referenced.");
+                continue;
+            }
+
+            if (vsg_accessor->properties.stride == vsg_accessor->valueSize())
+            {
+                std::memcpy(compacted->dataPointer(), vsg_accessor->dataPointer(), vsg_accessor->dataSize());
+            }
+            else
+            {
+                for (size_t i = 0; i < vsg_accessor->valueCount(); ++i)
+                {
+                    std::memcpy(compacted->dataPointer(i), vsg_accessor->dataPointer(i), vsg_accessor->valueSize());
+                }
+            }
+
+            compacted->properties.format = vsg_accessor->properties.format;
+            vsg_accessor = compacted;
+        }
+        else if (vsg_accessor && gltf_accessor && gltf_accessor->bufferView && copyBufferView[gltf_accessor->bufferView.value])
+        {
+            // recreate the view over the copied bufferView, any sparse or in place modifications are included in the copied bytes.
+            vsg_accessor = createArray(gltf_accessor->type, gltf_accessor->componentType, gltf_accessor->bufferView, gltf_accessor->byteOffset, gltf_accessor->count);
+        }
+    }
+}
+
+void gltf::Builder::releaseBuffers()
+{
+    auto withinBuffers = [&](const vsg::Data& data) {
+        auto ptr = static_cast<const uint8_t*>(data.dataPointer());
+        for (auto& vsg_buffer : vsg_buffers)
+        {
+            if (!vsg_buffer) continue;
+            auto begin = static_cast<const uint8_t*>(vsg_buffer->dataPointer());
+            if (ptr >= begin && ptr < begin + vsg_buffer->dataSize()) return true;
+        }
+        return false;
+    };
+
+    // images that weren't decoded by resolveURIs() are views of their bufferView so need their own copy.
+    for (auto& vsg_image : vsg_images)
+    {
+        if (!vsg_image || !withinBuffers(*vsg_image)) continue;
+
+        auto image = vsg::ubyteArray::create(static_cast<uint32_t>(vsg_image->dataSize()));
+        std::memcpy(image->dataPointer(), vsg_image->dataPointer(), vsg_image->dataSize());
+        vsg_image = image;
+    }
+
+    // keep the bufferViews copied by compactAccessors() for interleaved attributes.
+    for (auto& vsg_bufferView : vsg_bufferViews)
+    {
+        if (vsg_bufferView && withinBuffers(*vsg_bufferView)) vsg_bufferView = {};
+    }
+
+    for (size_t bi = 0; bi < vsg_buffers.size(); ++bi)
+    {
+        vsg_buffers[bi] = {};
+        if (auto& gltf_buffer = model->buffers.values[bi]) gltf_buffer->data = {};
+    }
+}
+
+void gltf::Builder::compressAccessors()
+{
+    // the attribute each float accessor is used for, KHR_mesh_quantization accessors are already compact so are left as they are.
+    enum Usage : uint8_t
+    {
+        UNUSED,
+        NORMAL,
+        TEXCOORD,
+        COLOR
+    };
+
+    std::vector<Usage> usage(vsg_accessors.size(), UNUSED);
+    for (auto& gltf_mesh : model->meshes.values)
+    {
+        if (!gltf_mesh) continue;
+        for (auto& primitive : gltf_mesh->primitives.values)
+        {
+            for (auto& [semantic, id] : primitive->attributes.values)
+            {
+                if (id.value >= usage.size()) continue;
+
+                if (semantic == "NORMAL")
+                    usage[id.value] = NORMAL;
+                else if (semantic.compare(0, 9, "TEXCOORD_") == 0)
+                    usage[id.value] = TEXCOORD;
+                else if (semantic == "COLOR_0")
+                    usage[id.value] = COLOR;
+            }
+        }
+    }
+
+    vsg_compressedAccessors.clear();
+    vsg_compressedAccessors.resize(vsg_accessors.size());
+    runInParallel(vsg_accessors.size(), [&](size_t ai) {
+        auto& gltf_accessor = model->accessors.values[ai];
+        if (usage[ai] == UNUSED || !vsg_accessors[ai] || !gltf_accessor || gltf_accessor->componentType != COMPONENT_TYPE_FLOAT) return;
+
+        auto& array = *vsg_accessors[ai];
+        if (usage[ai] == NORMAL)
+            vsg_compressedAccessors[ai] = compressNormals(array);
+        else if (usage[ai] == TEXCOORD)
+            vsg_compressedAccessors[ai] = compressTexCoords(array);
+        else
+            vsg_compressedAccessors[ai] = compressColors(array);
+    }, parallelBuild);
+
+    if (shareAccessors)
+    {
+        auto dataCache = sharedObjects->shareDefault<DataCache>();
+        for (auto& compressed : vsg_compressedAccessors)
+        {
+            if (compressed) compressed = dataCache->share(compressed);
+        }
+    }
+}
+
 vsg::ref_ptr<vsg::Camera> gltf::Builder::createCamera(vsg::ref_ptr<gltf::Camera> gltf_camera)
 {
     auto vsg_camera = vsg::Camera::create();
@@ -354,6 +654,20 @@ vsg::ref_ptr<vsg::Data> gltf::Builder::createImage(vsg::ref_ptr<gltf::Image> glt
     {
         auto data = vsg_bufferViews[gltf_image->bufferView.value];
         // vsg::info("createImage(", gltf_image, ") bufferView = ", gltf_image->bufferView, ", vsg_bufferView = ", data);
+
+        if (data && shareImages)
+        {
+            // image not decoded by glTF::resolveURIs() so decode it, sharing with any previous loads of the same encoded image.
+            if (auto extensionHint = gltf::mimeTypeToExtension(gltf_image->mimeType); !extensionHint.empty())
+            {
+                auto local_options = options ? vsg::clone(options) : vsg::Options::create();
+                local_options->extensionHint = extensionHint;
+
+                auto dataCache = sharedObjects->shareDefault<DataCache>();
+                if (auto image = dataCache->read(static_cast<const uint8_t*>(data->dataPointer()), data->dataSize(), local_options)) return image;
+            }
+        }
+
         return data;
     }
     else
@@ -464,7 +778,13 @@ gltf::Builder::SamplerImage gltf::Builder::createTexture(vsg::ref_ptr<gltf::Text
         samplerImage.sampler = vsg_samplers[gltf_texture->sampler.value];
     }
 
-    if (gltf_texture->source)
+    // prefer the KTX2 image as it stays block compressed on the GPU, falling back to source if it couldn't be read.
+    if (auto texture_basisu = gltf_texture->extension<KHR_texture_basisu>("KHR_texture_basisu"); texture_basisu && texture_basisu->source)
+    {
+        samplerImage.image = vsg_images[texture_basisu->source.value];
+    }
+
+    if (!samplerImage.image && gltf_texture->source)
     {
         samplerImage.image = vsg_images[gltf_texture->source.value];
     }
@@ -777,860 +1097,2439 @@ vsg::ref_ptr<vsg::DescriptorConfigurator> gltf::Builder::createMaterial(vsg::ref
         return createPbrMaterial(gltf_material);
 }
 
-vsg::ref_ptr<vsg::Node> gltf::Builder::createMesh(vsg::ref_ptr<gltf::Mesh> gltf_mesh, const MeshExtras& meshExtras)
+namespace
 {
-    /*
-    struct Attributes : public vsg::Inherit<vsg::JSONParser::Schema, Attributes>
+    template<class DestArray, class SrcArray>
+    vsg::ref_ptr<vsg::Data> dequantizeArray(const SrcArray& src, bool normalized, float maxValue)
     {
-        std::map<std::string, glTFid> values;
-    };
+        auto dest = DestArray::create(static_cast<uint32_t>(src.size()));
+        auto dest_itr = dest->begin();
+        for (auto& v : src)
+        {
+            auto& d = *(dest_itr++);
+            for (size_t i = 0; i < d.size(); ++i)
+            {
+                float f = static_cast<float>(v[i]);
+                d[i] = normalized ? std::max(f / maxValue, -1.0f) : f;
+            }
+        }
+        return dest;
+    }
 
-    struct Primitive : public vsg::Inherit<ExtensionsExtras, Primitive>
+    template<class T>
+    vsg::ref_ptr<vsg::Data> viewWithFormat(vsg::ref_ptr<vsg::Data> array, VkFormat format)
     {
-        Attributes attributes;
-        glTFid indices;
-        glTFid material;
-        uint32_t mode = 0;
-        vsg::ObjectsSchema<Attributes> targets;
-    };
+        auto src = array.cast<T>();
+        auto properties = src->properties;
+        properties.format = format;
+        return T::create(array, 0, properties.stride, static_cast<uint32_t>(src->size()), properties);
+    }
+} // namespace
 
-    struct Mesh : public vsg::Inherit<NameExtensionsExtras, Mesh>
+vsg::ref_ptr<vsg::Data> gltf::Builder::dequantize(vsg::ref_ptr<vsg::Data> array, bool normalized)
+{
+    if (auto bv2 = array.cast<vsg::bvec2Array>()) return dequantizeArray<vsg::vec2Array>(*bv2, normalized, 127.0f);
+    if (auto ubv2 = array.cast<vsg::ubvec2Array>()) return dequantizeArray<vsg::vec2Array>(*ubv2, normalized, 255.0f);
+    if (auto sv2 = array.cast<vsg::svec2Array>()) return dequantizeArray<vsg::vec2Array>(*sv2, normalized, 32767.0f);
+    if (auto usv2 = array.cast<vsg::usvec2Array>()) return dequantizeArray<vsg::vec2Array>(*usv2, normalized, 65535.0f);
+    if (auto bv3 = array.cast<vsg::bvec3Array>()) return dequantizeArray<vsg::vec3Array>(*bv3, normalized, 127.0f);
+    if (auto ubv3 = array.cast<vsg::ubvec3Array>()) return dequantizeArray<vsg::vec3Array>(*ubv3, normalized, 255.0f);
+    if (auto sv3 = array.cast<vsg::svec3Array>()) return dequantizeArray<vsg::vec3Array>(*sv3, normalized, 32767.0f);
+    if (auto usv3 = array.cast<vsg::usvec3Array>()) return dequantizeArray<vsg::vec3Array>(*usv3, normalized, 65535.0f);
+    if (auto bv4 = array.cast<vsg::bvec4Array>()) return dequantizeArray<vsg::vec4Array>(*bv4, normalized, 127.0f);
+    if (auto ubv4 = array.cast<vsg::ubvec4Array>()) return dequantizeArray<vsg::vec4Array>(*ubv4, normalized, 255.0f);
+    if (auto sv4 = array.cast<vsg::svec4Array>()) return dequantizeArray<vsg::vec4Array>(*sv4, normalized, 32767.0f);
+    if (auto usv4 = array.cast<vsg::usvec4Array>()) return dequantizeArray<vsg::vec4Array>(*usv4, normalized, 65535.0f);
+    return array;
+}
+
+vsg::ref_ptr<vsg::Data> gltf::Builder::assignQuantizedFormat(vsg::ref_ptr<vsg::Data> array, bool normalized, bool allowPadding)
+{
+    // when the stride leaves room for a 4th component, use the 4 component formats that Vulkan guarantees vertex buffer support for,
+    // the padding value is discarded as the shader inputs only use the first 3 components.
+    uint32_t stride = array->properties.stride;
+    bool pad8 = allowPadding && stride >= 4;
+    bool pad16 = allowPadding && stride >= 8;
+
+    if (array.cast<vsg::bvec2Array>()) return viewWithFormat<vsg::bvec2Array>(array, normalized ? VK_FORMAT_R8G8_SNORM : VK_FORMAT_R8G8_SSCALED);
+    if (array.cast<vsg::ubvec2Array>()) return viewWithFormat<vsg::ubvec2Array>(array, normalized ? VK_FORMAT_R8G8_UNORM : VK_FORMAT_R8G8_USCALED);
+    if (array.cast<vsg::svec2Array>()) return viewWithFormat<vsg::svec2Array>(array, normalized ? VK_FORMAT_R16G16_SNORM : VK_FORMAT_R16G16_SSCALED);
+    if (array.cast<vsg::usvec2Array>()) return viewWithFormat<vsg::usvec2Array>(array, normalized ? VK_FORMAT_R16G16_UNORM : VK_FORMAT_R16G16_USCALED);
+    if (array.cast<vsg::bvec3Array>() && pad8) return viewWithFormat<vsg::bvec3Array>(array, normalized ? VK_FORMAT_R8G8B8A8_SNORM : VK_FORMAT_R8G8B8A8_SSCALED);
+    if (array.cast<vsg::ubvec3Array>() && pad8) return viewWithFormat<vsg::ubvec3Array>(array, normalized ? VK_FORMAT_R8G8B8A8_UNORM : VK_FORMAT_R8G8B8A8_USCALED);
+    if (array.cast<vsg::svec3Array>() && pad16) return viewWithFormat<vsg::svec3Array>(array, normalized ? VK_FORMAT_R16G16B16A16_SNORM : VK_FORMAT_R16G16B16A16_SSCALED);
+    if (array.cast<vsg::usvec3Array>() && pad16) return viewWithFormat<vsg::usvec3Array>(array, normalized ? VK_FORMAT_R16G16B16A16_UNORM : VK_FORMAT_R16G16B16A16_USCALED);
+    if (array.cast<vsg::bvec4Array>()) return viewWithFormat<vsg::bvec4Array>(array, normalized ? VK_FORMAT_R8G8B8A8_SNORM : VK_FORMAT_R8G8B8A8_SSCALED);
+    if (array.cast<vsg::ubvec4Array>()) return viewWithFormat<vsg::ubvec4Array>(array, normalized ? VK_FORMAT_R8G8B8A8_UNORM : VK_FORMAT_R8G8B8A8_USCALED);
+    if (array.cast<vsg::svec4Array>()) return viewWithFormat<vsg::svec4Array>(array, normalized ? VK_FORMAT_R16G16B16A16_SNORM : VK_FORMAT_R16G16B16A16_SSCALED);
+    if (array.cast<vsg::usvec4Array>()) return viewWithFormat<vsg::usvec4Array>(array, normalized ? VK_FORMAT_R16G16B16A16_UNORM : VK_FORMAT_R16G16B16A16_USCALED);
+
+    // 3 component 8/16bit vertex formats aren't widely supported so fallback to float.
+    return dequantize(array, normalized);
+}
+
+bool gltf::Builder::getBounds(const gltf::Accessor& accessor, vsg::dbox& bounds)
+{
+    if (accessor.min.values.size() < 3 || accessor.max.values.size() < 3) return false;
+
+    double scale = 1.0;
+    if (accessor.normalized)
     {
-        vsg::ObjectsSchema<Primitive> primitives;
-        vsg::ValuesSchema<double> weights;
-    };
-*/
+        switch (accessor.componentType)
+        {
+        case (COMPONENT_TYPE_BYTE): scale = 1.0 / 127.0; break;
+        case (COMPONENT_TYPE_UNSIGNED_BYTE): scale = 1.0 / 255.0; break;
+        case (COMPONENT_TYPE_SHORT): scale = 1.0 / 32767.0; break;
+        case (COMPONENT_TYPE_UNSIGNED_SHORT): scale = 1.0 / 65535.0; break;
+        default: break;
+        }
+    }
 
-    const VkPrimitiveTopology topologyLookup[] = {
-        VK_PRIMITIVE_TOPOLOGY_POINT_LIST,     // 0, POINTS
-        VK_PRIMITIVE_TOPOLOGY_LINE_LIST,      // 1, LINES
-        VK_PRIMITIVE_TOPOLOGY_LINE_LIST,      // 2, LINE_LOOP, need special handling
-        VK_PRIMITIVE_TOPOLOGY_LINE_STRIP,     // 3, LINE_STRIP
-        VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,  // 4, TRIANGLES
-        VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP, // 5, TRIANGLE_STRIP
-        VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN    // 6, TRIANGLE_FAN
+    for (int i = 0; i < 3; ++i)
+    {
+        bounds.min[i] = accessor.min.values[i] * scale;
+        bounds.max[i] = accessor.max.values[i] * scale;
+        if (accessor.normalized && bounds.min[i] < -1.0) bounds.min[i] = -1.0;
+    }
+    return true;
+}
+
+bool gltf::Builder::getPrimitiveBounds(const gltf::Primitive& primitive, vsg::dbox& bounds)
+{
+    auto position_itr = primitive.attributes.values.find("POSITION");
+    if (position_itr == primitive.attributes.values.end() || position_itr->second.value >= model->accessors.values.size()) return false;
+
+    auto& position_accessor = model->accessors.values[position_itr->second.value];
+    if (!position_accessor || !getBounds(*position_accessor, bounds)) return false;
+
+    // morph targets displace the positions by their weighted deltas, assume weights in the 0 to 1 range.
+    for (auto& target : primitive.targets.values)
+    {
+        auto target_itr = target->values.find("POSITION");
+        if (target_itr == target->values.end() || target_itr->second.value >= model->accessors.values.size()) continue;
+
+        vsg::dbox delta;
+        auto& target_accessor = model->accessors.values[target_itr->second.value];
+        if (!target_accessor || !getBounds(*target_accessor, delta)) return false;
+
+        for (int i = 0; i < 3; ++i)
+        {
+            bounds.min[i] += std::min(delta.min[i], 0.0);
+            bounds.max[i] += std::max(delta.max[i], 0.0);
+        }
+    }
+    return true;
+}
+
+bool gltf::Builder::getMeshBounds(const gltf::Mesh& mesh, vsg::dbox& bounds)
+{
+    for (auto& primitive : mesh.primitives.values)
+    {
+        vsg::dbox primitiveBounds;
+        if (!getPrimitiveBounds(*primitive, primitiveBounds)) return false;
+        bounds.add(primitiveBounds);
+    }
+    return bounds.valid();
+}
+
+bool gltf::Builder::getInstancedBounds(const gltf::Attributes& instancedAttributes, vsg::dbox& bounds)
+{
+    auto getArray = [&](const char* name) -> vsg::ref_ptr<vsg::Data> {
+        auto itr = instancedAttributes.values.find(name);
+        if (itr == instancedAttributes.values.end() || itr->second.value >= vsg_accessors.size() || !vsg_accessors[itr->second.value]) return {};
+        return dequantize(vsg_accessors[itr->second.value], model->accessors.values[itr->second.value]->normalized);
     };
-#if 0
-    vsg::info("mesh = {");
-    vsg::info("    primitives = ", gltf_mesh->primitives.values.size());
-    vsg::info("    weight = ", gltf_mesh->weights.values.size());
-#endif
 
-    std::vector<vsg::ref_ptr<vsg::Node>> nodes;
+    auto translations = getArray("TRANSLATION").cast<vsg::vec3Array>();
+    auto rotations = getArray("ROTATION").cast<vsg::vec4Array>();
+    auto scales = getArray("SCALE").cast<vsg::vec3Array>();
 
-    for (auto& primitive : gltf_mesh->primitives.values)
+    size_t count = 0;
+    if (translations) count = std::max(count, translations->size());
+    if (rotations) count = std::max(count, rotations->size());
+    if (scales) count = std::max(count, scales->size());
+    if (count == 0) return false;
+
+    vsg::dbox local = bounds;
+    bounds = {};
+
+    for (size_t i = 0; i < count; ++i)
     {
-        vsg::ref_ptr<vsg::DescriptorConfigurator> vsg_material;
-        if (primitive->material)
+        vsg::dvec3 translation(0.0, 0.0, 0.0), scale(1.0, 1.0, 1.0);
+        vsg::dquat rotation;
+        if (translations && i < translations->size()) translation = vsg::dvec3(translations->at(i));
+        if (rotations && i < rotations->size())
         {
-            vsg_material = vsg_materials[primitive->material.value];
+            auto& r = rotations->at(i);
+            rotation.set(r.x, r.y, r.z, r.w);
         }
-        else
+        if (scales && i < scales->size()) scale = vsg::dvec3(scales->at(i));
+
+        auto matrix = vsg::translate(translation) * vsg::rotate(rotation) * vsg::scale(scale);
+        for (int corner = 0; corner < 8; ++corner)
         {
-            vsg::debug("Material for primitive not assigned, primitive = ", primitive, ", primitive->material = ", primitive->material);
-            vsg_material = default_material;
+            vsg::dvec3 v((corner & 1) ? local.max.x : local.min.x, (corner & 2) ? local.max.y : local.min.y, (corner & 4) ? local.max.z : local.min.z);
+            bounds.add(matrix * v);
         }
+    }
+    return bounds.valid();
+}
 
-        auto config = vsg::GraphicsPipelineConfigurator::create(vsg_material->shaderSet);
-        config->descriptorConfigurator = vsg_material;
-        if (options) config->assignInheritedState(options->inheritedState);
+bool gltf::Builder::getNodeBounds(uint32_t ni, const vsg::dmat4& inheritedTransform, vsg::dbox& bounds, std::vector<bool>& visited)
+{
+    if (ni >= model->nodes.values.size() || !model->nodes.values[ni] || visited[ni]) return true;
+    visited[ni] = true;
 
-        if (meshExtras.jointSampler)
+    auto& gltf_node = model->nodes.values[ni];
+
+    vsg::dmat4 accumulatedTransform = inheritedTransform;
+    vsg::dmat4 localMatrix;
+    if (getTransform(*gltf_node, localMatrix)) accumulatedTransform = accumulatedTransform * localMatrix;
+
+    // skinned meshes are bounded in their bind pose placed by the node hierarchy, as ComputeBounds does, the joint transforms aren't taken into account.
+    if (gltf_node->mesh && gltf_node->mesh.value < model->meshes.values.size() && model->meshes.values[gltf_node->mesh.value])
+    {
+        vsg::dbox meshBounds;
+        if (!getMeshBounds(*model->meshes.values[gltf_node->mesh.value], meshBounds)) return false;
+
+        if (auto mesh_gpu_instancing = gltf_node->extension<EXT_mesh_gpu_instancing>("EXT_mesh_gpu_instancing"))
         {
-            vsg_material->assignDescriptor("jointMatrices", meshExtras.jointSampler->jointMatrices);
+            if (!mesh_gpu_instancing->attributes || !getInstancedBounds(*mesh_gpu_instancing->attributes, meshBounds)) return false;
         }
 
-#if 0
-        vsg::info("    primitive = {");
-        vsg::info("        attributes = {");
-        for(auto& [semantic, id] : primitive->attributes.values)
+        for (int corner = 0; corner < 8; ++corner)
         {
-             vsg::info("            ", semantic, ", ", id);
+            vsg::dvec3 v((corner & 1) ? meshBounds.max.x : meshBounds.min.x, (corner & 2) ? meshBounds.max.y : meshBounds.min.y, (corner & 4) ? meshBounds.max.z : meshBounds.min.z);
+            bounds.add(accumulatedTransform * v);
         }
-        vsg::info("        }");
-        vsg::info("        indices = ", primitive->indices);
-        vsg::info("        material = ", primitive->material);
-        vsg::info("        mode = ", primitive->mode);
-        vsg::info("        targets = ", primitive->targets.values.size()) ;
+    }
 
-        vsg::info("        * topology = ", topologyLookup[primitive->mode]) ;
-        if (primitive->mode==2) vsg::info("        * LINE_LOOP needs special handling.");
+    for (auto& child : gltf_node->children.values)
+    {
+        if (!getNodeBounds(child.value, accumulatedTransform, bounds, visited)) return false;
+    }
+    return true;
+}
 
-        vsg::info("    }");
-#endif
+namespace
+{
+    // Tom Forsyth's linear-speed vertex cache optimisation, https://tomforsyth1000.github.io/papers/fast_vert_cache_opt.html
+    struct VertexCacheOptimizer
+    {
+        static constexpr int cacheSize = 32;
+        static constexpr float cacheDecayPower = 1.5f;
+        static constexpr float lastTriScore = 0.75f;
+        static constexpr float valenceBoostScale = 2.0f;
+        static constexpr float valenceBoostPower = 0.5f;
 
-        vsg::DataList vertexArrays;
+        static float vertexScore(int cachePosition, uint32_t remainingValence)
+        {
+            if (remainingValence == 0) return -1.0f;
 
-        auto assignArray = [&](Attributes& attrib, VkVertexInputRate vertexInputRate, const std::string& attribute_name) -> bool {
-            auto array_itr = attrib.values.find(attribute_name);
-            if (array_itr == attrib.values.end()) return false;
+            float score = 0.0f;
+            if (cachePosition >= 0)
+            {
+                if (cachePosition < 3)
+                    score = lastTriScore;
+                else
+                    score = std::pow(1.0f - static_cast<float>(cachePosition - 3) / static_cast<float>(cacheSize - 3), cacheDecayPower);
+            }
 
-            auto name_itr = attributeLookup.find(attribute_name);
-            if (name_itr == attributeLookup.end()) return false;
+            return score + valenceBoostScale * std::pow(static_cast<float>(remainingValence), -valenceBoostPower);
+        }
 
-            if (array_itr->second.value >= vsg_accessors.size())
+        template<typename T>
+        static void optimize(T* indices, size_t indexCount, size_t vertexCount)
+        {
+            size_t triangleCount = indexCount / 3;
+            if (triangleCount < 2) return;
+
+            // build vertex -> triangle adjacency
+            std::vector<uint32_t> valence(vertexCount, 0);
+            for (size_t i = 0; i < triangleCount * 3; ++i) ++valence[indices[i]];
+
+            std::vector<uint32_t> offsets(vertexCount + 1, 0);
+            for (size_t v = 0; v < vertexCount; ++v) offsets[v + 1] = offsets[v] + valence[v];
+
+            std::vector<uint32_t> adjacency(offsets[vertexCount]);
+            std::vector<uint32_t> fill(offsets.begin(), offsets.end() - 1);
+            for (size_t t = 0; t < triangleCount; ++t)
             {
-                vsg::warn("gltf::Builder::createMesh() error in assignArray( attrib, vertexIndexRate", attribute_name, "), array index out of range.");
-                return false;
+                for (size_t c = 0; c < 3; ++c) adjacency[fill[indices[t * 3 + c]]++] = static_cast<uint32_t>(t);
             }
 
-            vsg::ref_ptr<vsg::Data> array = vsg_accessors[array_itr->second.value];
-            if (!array)
-            {
-                vsg::warn("gltf::Builder::createMesh() error in assignArray( attrib, vertexIndexRate", attribute_name, "), required array null.");
-                return false;
-            }
+            std::vector<int> cachePosition(vertexCount, -1);
+            std::vector<float> vertexScores(vertexCount);
+            for (size_t v = 0; v < vertexCount; ++v) vertexScores[v] = vertexScore(-1, valence[v]);
 
-            if (attribute_name == "ROTATION")
+            std::vector<bool> emitted(triangleCount, false);
+            std::vector<T> output(triangleCount * 3);
+
+            std::vector<uint32_t> cache, newCache;
+            cache.reserve(cacheSize + 3);
+            newCache.reserve(cacheSize + 3);
+
+            size_t searchStart = 0;
+            int64_t bestTriangle = -1;
+
+            for (size_t n = 0; n < triangleCount; ++n)
             {
-                if (auto vec4Rotations = array.cast<vsg::vec4Array>())
+                if (bestTriangle < 0)
                 {
-                    auto quatArray = vsg::quatArray::create(array, 0, 12, vec4Rotations->size());
-                    array = quatArray;
+                    // no candidate adjacent to the cache, so pick the next triangle not yet emitted.
+                    while (emitted[searchStart]) ++searchStart;
+                    bestTriangle = static_cast<int64_t>(searchStart);
                 }
-            }
-            else if (attribute_name == "TEXCOORD_0" || attribute_name == "TEXCOORD_1" || attribute_name == "TEXCOORD_2" || attribute_name == "TEXCOORD_3")
-            {
-                if (auto texture_transform = vsg_material->getObject<KHR_texture_transform>("KHR_texture_transform"))
+
+                uint32_t t = static_cast<uint32_t>(bestTriangle);
+                emitted[t] = true;
+
+                const T* tri = indices + t * 3;
+                for (size_t c = 0; c < 3; ++c)
                 {
-                    vsg::vec2 offset(0.0f, 0.0f);
-                    vsg::vec2 scale(1.0f, 1.0f);
-                    float rotation = texture_transform->rotation;
-                    if (texture_transform->offset.values.size() >= 2) offset.set(texture_transform->offset.values[0], texture_transform->offset.values[1]);
-                    if (texture_transform->scale.values.size() >= 2) scale.set(texture_transform->scale.values[0], texture_transform->scale.values[1]);
+                    uint32_t v = tri[c];
+                    output[n * 3 + c] = tri[c];
 
-                    if (auto texCoords = array.cast<vsg::vec2Array>())
+                    // remove the emitted triangle from the vertex's list of remaining triangles.
+                    uint32_t begin = offsets[v];
+                    uint32_t end = begin + valence[v];
+                    for (uint32_t i = begin; i < end; ++i)
                     {
-                        float sin_rotation = std::sin(rotation);
-                        float cos_rotation = std::cos(rotation);
-                        auto transformedTexCoords = vsg::vec2Array::create(texCoords->size());
-                        auto dest_itr = transformedTexCoords->begin();
-                        for (auto& tc : *texCoords)
+                        if (adjacency[i] == t)
                         {
-                            auto& dest_tc = *(dest_itr++);
-                            dest_tc.x = offset.x + (tc.x * scale.x) * cos_rotation + (tc.y * scale.y) * sin_rotation;
-                            dest_tc.y = offset.y + (tc.y * scale.y) * cos_rotation - (tc.x * scale.x) * sin_rotation;
+                            adjacency[i] = adjacency[end - 1];
+                            break;
                         }
-                        array = transformedTexCoords;
                     }
+                    --valence[v];
                 }
-            }
-            else if (attribute_name == "JOINTS_0")
-            {
-                if (auto ushortCoords = array.cast<vsg::usvec4Array>())
+
+                // update the simulated LRU cache, most recently used vertices first.
+                newCache.clear();
+                for (size_t c = 0; c < 3; ++c) newCache.push_back(tri[c]);
+                for (auto v : cache)
                 {
-                    auto intCoords = vsg::ivec4Array::create(ushortCoords->size());
-                    auto dest_itr = intCoords->begin();
-                    for (auto& usc : *ushortCoords)
-                    {
-                        *(dest_itr++) = vsg::ivec4(usc[0], usc[1], usc[2], usc[3]);
-                    }
+                    if (v != tri[0] && v != tri[1] && v != tri[2]) newCache.push_back(v);
+                }
 
-                    array = intCoords;
+                for (size_t i = 0; i < newCache.size(); ++i)
+                {
+                    uint32_t v = newCache[i];
+                    cachePosition[v] = (i < static_cast<size_t>(cacheSize)) ? static_cast<int>(i) : -1;
+                    vertexScores[v] = vertexScore(cachePosition[v], valence[v]);
                 }
-                else if (auto ubyteCoords = array.cast<vsg::ubvec4Array>())
+                if (newCache.size() > static_cast<size_t>(cacheSize)) newCache.resize(cacheSize);
+                std::swap(cache, newCache);
+
+                // rescore the triangles touched by vertices in the cache and select the best for the next iteration.
+                float bestScore = -1.0f;
+                bestTriangle = -1;
+                for (auto v : cache)
                 {
-                    auto intCoords = vsg::ivec4Array::create(ubyteCoords->size());
-                    auto dest_itr = intCoords->begin();
-                    for (auto& ubc : *ubyteCoords)
+                    for (uint32_t i = offsets[v]; i < offsets[v] + valence[v]; ++i)
                     {
-                        *(dest_itr++) = vsg::ivec4(ubc[0], ubc[1], ubc[2], ubc[3]);
+                        uint32_t at = adjacency[i];
+                        const T* atri = indices + at * 3;
+                        float score = vertexScores[atri[0]] + vertexScores[atri[1]] + vertexScores[atri[2]];
+                        if (score > bestScore)
+                        {
+                            bestScore = score;
+                            bestTriangle = at;
+                        }
                     }
-
-                    array = intCoords;
                 }
             }
 
-            config->assignArray(vertexArrays, name_itr->second, vertexInputRate, array);
-            return true;
-        };
-
-        if (!assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "POSITION"))
-        {
-            vsg::warn("gltf::Builder::createMesh() error no vertex array assigned.");
-            return {};
-        }
-
-        if (!assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "NORMAL"))
-        {
-            auto normal = vsg::vec3Value::create(vsg::vec3(0.0f, 0.0f, 1.0f));
-            config->assignArray(vertexArrays, "vsg_Normal", VK_VERTEX_INPUT_RATE_INSTANCE, normal);
-        }
-
-        if (!assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "TEXCOORD_0"))
-        {
-            auto texcoord = vsg::vec2Value::create(vsg::vec2(0.0f, 0.0f));
-            config->assignArray(vertexArrays, "vsg_TexCoord0", VK_VERTEX_INPUT_RATE_INSTANCE, texcoord);
+            std::copy(output.begin(), output.end(), indices);
         }
+    };
 
-        assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "TEXCOORD_1");
-        assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "TEXCOORD_2");
-        assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "TEXCOORD_3");
+    // reorder vertices into the order they are first referenced by the indices, updating the indices in place.
+    template<typename T>
+    std::vector<uint32_t> optimizeVertexFetch(T* indices, size_t indexCount, size_t vertexCount)
+    {
+        const uint32_t unassigned = std::numeric_limits<uint32_t>::max();
+        std::vector<uint32_t> oldToNew(vertexCount, unassigned);
+        std::vector<uint32_t> newToOld;
+        newToOld.reserve(vertexCount);
 
-        uint32_t vertexCount = static_cast<uint32_t>(vertexArrays.front()->valueCount());
-        uint32_t instanceCount = 1;
-        if (meshExtras.instancedAttributes)
+        for (size_t i = 0; i < indexCount; ++i)
         {
-            for (auto& [name, id] : meshExtras.instancedAttributes->values)
+            auto& newIndex = oldToNew[indices[i]];
+            if (newIndex == unassigned)
             {
-                instanceCount = static_cast<uint32_t>(vsg_accessors[id.value]->valueCount());
+                newIndex = static_cast<uint32_t>(newToOld.size());
+                newToOld.push_back(indices[i]);
             }
+            indices[i] = static_cast<T>(newIndex);
         }
 
-        if (!assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "COLOR_0"))
-        {
-            if (instanceNodeHint == vsg::Options::INSTANCE_NONE)
-            {
-                auto defaultColor = vsg::vec4Array::create(instanceCount, vsg::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-                config->assignArray(vertexArrays, "vsg_Color", VK_VERTEX_INPUT_RATE_INSTANCE, defaultColor);
-            }
-            else if ((instanceNodeHint & vsg::Options::INSTANCE_COLORS) == 0)
-            {
-                auto defaultColor = vsg::vec4Array::create(vertexCount, vsg::vec4(1.0f, 1.0f, 1.0f, 1.0f));
-                config->assignArray(vertexArrays, "vsg_Color", VK_VERTEX_INPUT_RATE_VERTEX, defaultColor);
-            }
-        }
+        return newToOld;
+    }
 
-        if (meshExtras.jointSampler)
+    template<class T>
+    bool remapArray(vsg::ref_ptr<vsg::Data>& array, const std::vector<uint32_t>& newToOld)
+    {
+        auto src = array.cast<T>();
+        if (!src) return false;
+
+        // keep any padding required by the vertex format, but drop interleaved data belonging to other attributes.
+        auto properties = src->properties;
+        uint32_t stride = std::min(properties.stride, (static_cast<uint32_t>(sizeof(typename T::value_type)) + 3u) & ~3u);
+        uint32_t count = static_cast<uint32_t>(newToOld.size());
+
+        // only copy the value itself, the padding of the last element may lie beyond the end of the bufferView.
+        auto storage = vsg::ubyteArray::create(count * stride);
+        std::memset(storage->dataPointer(), 0, storage->dataSize());
+        auto dest = storage->data();
+        for (auto oldIndex : newToOld)
         {
-            assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "JOINTS_0");
-            assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "WEIGHTS_0");
+            std::memcpy(dest, src->dataPointer(oldIndex), sizeof(typename T::value_type));
+            dest += stride;
         }
 
-        if (meshExtras.instancedAttributes)
+        properties.stride = stride;
+        array = T::create(storage, 0, stride, count, properties);
+        return true;
+    }
+
+    bool remapVertexArray(vsg::ref_ptr<vsg::Data>& array, const std::vector<uint32_t>& newToOld)
+    {
+        return remapArray<vsg::floatArray>(array, newToOld) ||
+               remapArray<vsg::vec2Array>(array, newToOld) ||
+               remapArray<vsg::vec3Array>(array, newToOld) ||
+               remapArray<vsg::vec4Array>(array, newToOld) ||
+               remapArray<vsg::bvec2Array>(array, newToOld) ||
+               remapArray<vsg::bvec3Array>(array, newToOld) ||
+               remapArray<vsg::bvec4Array>(array, newToOld) ||
+               remapArray<vsg::ubvec2Array>(array, newToOld) ||
+               remapArray<vsg::ubvec3Array>(array, newToOld) ||
+               remapArray<vsg::ubvec4Array>(array, newToOld) ||
+               remapArray<vsg::svec2Array>(array, newToOld) ||
+               remapArray<vsg::svec3Array>(array, newToOld) ||
+               remapArray<vsg::svec4Array>(array, newToOld) ||
+               remapArray<vsg::usvec2Array>(array, newToOld) ||
+               remapArray<vsg::usvec3Array>(array, newToOld) ||
+               remapArray<vsg::usvec4Array>(array, newToOld) ||
+               remapArray<vsg::ivec4Array>(array, newToOld) ||
+               remapArray<vsg::uivec4Array>(array, newToOld);
+    }
+
+    template<typename T>
+    void optimizeTriangles(T* indices, size_t indexCount, vsg::DataList& vertexArrays, const std::vector<size_t>& perVertexArrays)
+    {
+        size_t vertexCount = vertexArrays[perVertexArrays.front()]->valueCount();
+        for (size_t i = 0; i < indexCount; ++i)
         {
-            assignArray(*meshExtras.instancedAttributes, VK_VERTEX_INPUT_RATE_INSTANCE, "TRANSLATION");
-            assignArray(*meshExtras.instancedAttributes, VK_VERTEX_INPUT_RATE_INSTANCE, "ROTATION");
-            assignArray(*meshExtras.instancedAttributes, VK_VERTEX_INPUT_RATE_INSTANCE, "SCALE");
+            if (indices[i] >= vertexCount) return;
         }
 
-        vsg::ref_ptr<vsg::Node> draw;
+        VertexCacheOptimizer::optimize(indices, indexCount, vertexCount);
 
-        if (!meshExtras.instancedAttributes && instanceNodeHint != vsg::Options::INSTANCE_NONE)
+        std::vector<T> reorderedIndices(indices, indices + indexCount);
+        auto newToOld = optimizeVertexFetch(reorderedIndices.data(), indexCount, vertexCount);
+
+        // only apply the vertex fetch reordering if all the per vertex arrays can be remapped.
+        vsg::DataList remappedArrays;
+        for (auto index : perVertexArrays)
         {
-            if ((instanceNodeHint & vsg::Options::INSTANCE_COLORS) != 0) config->enableArray("vsg_Color", VK_VERTEX_INPUT_RATE_INSTANCE, 16, VK_FORMAT_R32G32B32A32_SFLOAT);
-            if ((instanceNodeHint & vsg::Options::INSTANCE_TRANSLATIONS) != 0) config->enableArray("vsg_Translation", VK_VERTEX_INPUT_RATE_INSTANCE, 12, VK_FORMAT_R32G32B32_SFLOAT);
-            if ((instanceNodeHint & vsg::Options::INSTANCE_ROTATIONS) != 0) config->enableArray("vsg_Rotation", VK_VERTEX_INPUT_RATE_INSTANCE, 16, VK_FORMAT_R32G32B32A32_SFLOAT);
-            if ((instanceNodeHint & vsg::Options::INSTANCE_SCALES) != 0) config->enableArray("vsg_Scale", VK_VERTEX_INPUT_RATE_INSTANCE, 12, VK_FORMAT_R32G32B32_SFLOAT);
+            auto array = vertexArrays[index];
+            if (array->valueCount() != vertexCount || !remapVertexArray(array, newToOld)) return;
+            remappedArrays.push_back(array);
+        }
 
-            if (primitive->indices)
-            {
-                auto instanceDrawIndexed = vsg::InstanceDrawIndexed::create();
-                assign_extras(*primitive, *instanceDrawIndexed);
-                instanceDrawIndexed->assignArrays(vertexArrays);
+        for (size_t i = 0; i < perVertexArrays.size(); ++i) vertexArrays[perVertexArrays[i]] = remappedArrays[i];
+        std::copy(reorderedIndices.begin(), reorderedIndices.end(), indices);
+    }
 
-                auto indices = vsg_accessors[primitive->indices.value];
-                if (!indices)
-                {
-                    vsg::warn("gltf::Builder::createMesh() error required indices array null.");
-                    return {};
-                }
+    struct TriangleCluster
+    {
+        uint32_t firstIndex = 0;
+        uint32_t indexCount = 0;
+        vsg::dsphere bound;
+    };
 
-                if (auto ubyte_indices = indices.cast<vsg::ubyteArray>())
-                {
-                    // need to promote ubyte indices to ushort as Vulkan requires an extension to be enabled for ubyte indices.
-                    auto ushort_indices = vsg::ushortArray::create(ubyte_indices->size());
-                    auto itr = ushort_indices->begin();
-                    for (auto value : *ubyte_indices)
-                    {
-                        *(itr++) = static_cast<uint16_t>(value);
-                    }
+    // spread the bottom 10 bits of v so there are two zero bits between each, used to interleave x, y and z into a Morton code.
+    uint32_t expandBits(uint32_t v)
+    {
+        v = (v * 0x00010001u) & 0xFF0000FFu;
+        v = (v * 0x00000101u) & 0x0F00F00Fu;
+        v = (v * 0x00000011u) & 0xC30C30C3u;
+        v = (v * 0x00000005u) & 0x49249249u;
+        return v;
+    }
 
-                    instanceDrawIndexed->assignIndices(ushort_indices);
-                    instanceDrawIndexed->indexCount = static_cast<uint32_t>(ushort_indices->valueCount());
-                }
-                else
-                {
-                    instanceDrawIndexed->assignIndices(indices);
-                    instanceDrawIndexed->indexCount = static_cast<uint32_t>(indices->valueCount());
-                }
-                draw = instanceDrawIndexed;
-            }
-            else
-            {
-                auto instanceDraw = vsg::InstanceDraw::create();
-                assign_extras(*primitive, *instanceDraw);
-                instanceDraw->assignArrays(vertexArrays);
-                instanceDraw->vertexCount = vertexCount;
-                draw = instanceDraw;
-            }
-        }
-        else if (primitive->indices)
+    template<typename T>
+    std::vector<TriangleCluster> clusterTriangles(T* indices, size_t indexCount, const vsg::vec3Array& positions, uint32_t clusterSize)
+    {
+        size_t triangleCount = indexCount / 3;
+        size_t vertexCount = positions.size();
+        for (size_t i = 0; i < triangleCount * 3; ++i)
         {
-            auto vid = vsg::VertexIndexDraw::create();
-            assign_extras(*primitive, *vid);
-            vid->assignArrays(vertexArrays);
-            vid->instanceCount = instanceCount;
-
-            auto indices = vsg_accessors[primitive->indices.value];
-            if (!indices)
-            {
-                vsg::warn("gltf::Builder::createMesh() error required indices array null.");
-                return {};
-            }
+            if (indices[i] >= vertexCount) return {};
+        }
 
-            if (auto ubyte_indices = indices.cast<vsg::ubyteArray>())
-            {
-                // need to promote ubyte indices to ushort as Vulkan requires an extension to be enabled for ubyte indices.
-                auto ushort_indices = vsg::ushortArray::create(ubyte_indices->size());
-                auto itr = ushort_indices->begin();
-                for (auto value : *ubyte_indices)
-                {
-                    *(itr++) = static_cast<uint16_t>(value);
-                }
+        auto position = [&](T index) {
+            auto& v = positions.at(index);
+            return vsg::dvec3(v.x, v.y, v.z);
+        };
 
-                vid->assignIndices(ushort_indices);
-                vid->indexCount = static_cast<uint32_t>(ushort_indices->valueCount());
-            }
-            else
-            {
-                vid->assignIndices(indices);
-                vid->indexCount = static_cast<uint32_t>(indices->valueCount());
-            }
+        vsg::dbox extents;
+        for (size_t i = 0; i < vertexCount; ++i) extents.add(position(static_cast<T>(i)));
 
-            draw = vid;
+        vsg::dvec3 scale;
+        for (int c = 0; c < 3; ++c)
+        {
+            double size = extents.max[c] - extents.min[c];
+            scale[c] = size > 0.0 ? 1023.0 / size : 0.0;
         }
-        else
+
+        // sorting the triangles by the Morton code of their centroids places neighbouring triangles in the same cluster.
+        std::vector<std::pair<uint32_t, uint32_t>> codes(triangleCount);
+        for (size_t t = 0; t < triangleCount; ++t)
         {
-            auto vd = vsg::VertexDraw::create();
-            assign_extras(*primitive, *vd);
-            vd->assignArrays(vertexArrays);
-            vd->instanceCount = instanceCount;
-            vd->vertexCount = vertexCount;
-            draw = vd;
+            vsg::dvec3 centroid = (position(indices[t * 3]) + position(indices[t * 3 + 1]) + position(indices[t * 3 + 2])) / 3.0;
+            vsg::dvec3 cell = (centroid - extents.min);
+            uint32_t x = static_cast<uint32_t>(std::clamp(cell.x * scale.x, 0.0, 1023.0));
+            uint32_t y = static_cast<uint32_t>(std::clamp(cell.y * scale.y, 0.0, 1023.0));
+            uint32_t z = static_cast<uint32_t>(std::clamp(cell.z * scale.z, 0.0, 1023.0));
+            codes[t] = {(expandBits(x) << 2) | (expandBits(y) << 1) | expandBits(z), static_cast<uint32_t>(t)};
         }
+        std::sort(codes.begin(), codes.end());
 
-        // set the GraphicsPipelineStates to the required values.
-        struct SetPipelineStates : public vsg::Visitor
+        std::vector<T> clusteredIndices(triangleCount * 3);
+        std::vector<TriangleCluster> clusters;
+        std::vector<uint32_t> triangles;
+        for (size_t first = 0; first < triangleCount; first += clusterSize)
         {
-            VkPrimitiveTopology topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
-            bool blending = false;
-            bool two_sided = false;
+            size_t last = std::min(first + clusterSize, triangleCount);
 
-            SetPipelineStates(VkPrimitiveTopology in_topology, bool in_blending, bool in_two_sided) :
-                topology(in_topology), blending(in_blending), two_sided(in_two_sided) {}
+            // keep the triangles in their original relative order so any vertex cache optimization is retained within the cluster.
+            triangles.clear();
+            for (size_t i = first; i < last; ++i) triangles.push_back(codes[i].second);
+            std::sort(triangles.begin(), triangles.end());
 
-            void apply(vsg::Object& object) { object.traverse(*this); }
-            void apply(vsg::RasterizationState& rs)
+            vsg::dbox bounds;
+            auto dest = clusteredIndices.data() + first * 3;
+            for (auto t : triangles)
             {
-                if (two_sided) rs.cullMode = VK_CULL_MODE_NONE;
+                for (size_t k = 0; k < 3; ++k)
+                {
+                    auto index = indices[t * 3 + k];
+                    bounds.add(position(index));
+                    *(dest++) = index;
+                }
             }
-            void apply(vsg::InputAssemblyState& ias) { ias.topology = topology; }
-            void apply(vsg::ColorBlendState& cbs) { cbs.configureAttachments(blending); }
-
-        } sps(topologyLookup[primitive->mode], vsg_material->blending, vsg_material->two_sided);
-
-        config->accept(sps);
 
-        if (sharedObjects)
-            sharedObjects->share(config, [](auto gpc) { gpc->init(); });
-        else
-            config->init();
+            vsg::dvec3 center = (bounds.min + bounds.max) * 0.5;
+            double radius = 0.0;
+            for (size_t i = first * 3; i < last * 3; ++i)
+            {
+                radius = std::max(radius, vsg::length(position(clusteredIndices[i]) - center));
+            }
 
-        // create StateGroup as the root of the scene/command graph to hold the GraphicsPipeline, and binding of Descriptors to decorate the whole graph
-        auto stateGroup = vsg::StateGroup::create();
+            TriangleCluster cluster;
+            cluster.firstIndex = static_cast<uint32_t>(first * 3);
+            cluster.indexCount = static_cast<uint32_t>((last - first) * 3);
+            cluster.bound = vsg::dsphere(center, radius);
+            clusters.push_back(cluster);
+        }
 
-        config->copyTo(stateGroup, sharedObjects);
+        std::copy(clusteredIndices.begin(), clusteredIndices.end(), indices);
+        return clusters;
+    }
+} // namespace
 
-        stateGroup->addChild(draw);
+vsg::ref_ptr<vsg::Data> gltf::Builder::processIndices(vsg::ref_ptr<vsg::Data> indices, uint32_t mode, vsg::DataList& vertexArrays, const std::vector<size_t>& perVertexArrays)
+{
+    // narrow the indices to ushort where possible, promoting ubyte indices as Vulkan requires an extension to be enabled for them.
+    vsg::ref_ptr<vsg::ushortArray> ushort_indices;
+    if (auto ubyte_indices = indices.cast<vsg::ubyteArray>())
+    {
+        ushort_indices = vsg::ushortArray::create(ubyte_indices->size());
+        std::copy(ubyte_indices->begin(), ubyte_indices->end(), ushort_indices->begin());
+    }
+    else if (auto uint_indices = indices.cast<vsg::uintArray>())
+    {
+        // check the index values rather than the vertex count so out of range indices aren't wrapped onto valid vertices, 65535 is left for primitive restart.
+        uint32_t maxIndex = 0;
+        for (auto value : *uint_indices) maxIndex = std::max(maxIndex, value);
 
-        if (vsg_material->blending)
+        if (maxIndex < 65535)
         {
-            if (meshExtras.instancedAttributes || instanceNodeHint != vsg::Options::INSTANCE_NONE)
-            {
-#if 0
-                auto layer = vsg::Layer::create();
-                layer->binNumber = 10;
-                layer->child = stateGroup;
-
-                nodes.push_back(layer);
-#else
-                nodes.push_back(stateGroup);
-#endif
-            }
-            else
+            ushort_indices = vsg::ushortArray::create(uint_indices->size());
+            auto itr = ushort_indices->begin();
+            for (auto value : *uint_indices)
             {
-                vsg::ComputeBounds computeBounds;
-                draw->accept(computeBounds);
-                vsg::dvec3 center = (computeBounds.bounds.min + computeBounds.bounds.max) * 0.5;
-                double radius = vsg::length(computeBounds.bounds.max - computeBounds.bounds.min) * 0.5;
-
-                auto depthSorted = vsg::DepthSorted::create();
-                depthSorted->binNumber = 10;
-                depthSorted->bound.set(center[0], center[1], center[2], radius);
-                depthSorted->child = stateGroup;
-
-                nodes.push_back(depthSorted);
+                *(itr++) = static_cast<uint16_t>(value);
             }
         }
-        else
-        {
-            nodes.push_back(stateGroup);
-        }
     }
 
-    if (nodes.empty())
+    // vertex cache and fetch reordering is only applicable to triangle lists.
+    if (!optimizeIndices || mode != 4 || perVertexArrays.empty())
     {
-        vsg::warn("Empty mesh");
-        return {};
+        if (ushort_indices) return ushort_indices;
+        return indices;
     }
 
-    vsg::ref_ptr<vsg::Node> vsg_mesh;
-    if (nodes.size() == 1)
-    {
-        // vsg::info("Mesh with single primtiive");
-        vsg_mesh = nodes.front();
-    }
-    else
+    // the source indices may be shared with other primitives so only reorder a copy of them.
+    if (!ushort_indices)
     {
-        // vsg::info("Mesh with multiple primtiives - could possible use vsg::Geomterty.");
-        auto group = vsg::Group::create();
-        for (auto node : nodes)
+        if (auto src = indices.cast<vsg::ushortArray>())
         {
-            group->addChild(node);
+            ushort_indices = vsg::ushortArray::create(src->size());
+            std::copy(src->begin(), src->end(), ushort_indices->begin());
         }
+    }
 
-        vsg_mesh = group;
+    if (ushort_indices)
+    {
+        optimizeTriangles(ushort_indices->data(), ushort_indices->size(), vertexArrays, perVertexArrays);
+        return ushort_indices;
     }
 
-    assign_name_extras(*gltf_mesh, *vsg_mesh);
+    if (auto src = indices.cast<vsg::uintArray>())
+    {
+        auto uint_indices = vsg::uintArray::create(src->size());
+        std::copy(src->begin(), src->end(), uint_indices->begin());
+        optimizeTriangles(uint_indices->data(), uint_indices->size(), vertexArrays, perVertexArrays);
+        return uint_indices;
+    }
 
-    return vsg_mesh;
+    return indices;
 }
 
-bool gltf::Builder::getTransform(gltf::Node& node, vsg::dmat4& matrix)
+void gltf::Builder::interleaveArrays(vsg::GraphicsPipelineConfigurator& config, vsg::DataList& vertexArrays, const std::vector<size_t>& perVertexArrays)
 {
-    if (node.matrix.values.size() == 16)
+    // assignArray() adds one binding and one attribute description per array, anything else has been set up in a way we can't remap.
+    auto& vertexInputState = config.vertexInputState;
+    size_t numArrays = vertexArrays.size();
+    if (!vertexInputState || vertexInputState->vertexBindingDescriptions.size() != numArrays || vertexInputState->vertexAttributeDescriptions.size() != numArrays) return;
+
+    for (size_t i = 0; i < numArrays; ++i)
+    {
+        uint32_t binding = config.baseAttributeBinding + static_cast<uint32_t>(i);
+        if (vertexInputState->vertexBindingDescriptions[i].binding != binding || vertexInputState->vertexAttributeDescriptions[i].binding != binding) return;
+    }
+
+    // for each array, the array whose vertex buffer it's read from, and the offset of its attribute within that buffer's stride.
+    std::vector<size_t> bindingArrays(numArrays);
+    std::vector<uint32_t> offsets(numArrays, 0);
+    for (size_t i = 0; i < numArrays; ++i) bindingArrays[i] = i;
+
+    bool interleaved = false;
+    for (size_t pi = 0; pi < perVertexArrays.size(); ++pi)
+    {
+        size_t base = perVertexArrays[pi];
+        if (bindingArrays[base] != base) continue;
+
+        // arrays that have been converted or reordered are tightly packed copies, only strided views remain candidates.
+        auto& baseArray = vertexArrays[base];
+        uint32_t stride = baseArray->properties.stride;
+        size_t count = baseArray->valueCount();
+        if (stride <= baseArray->valueSize() || count == 0) continue;
+
+        // the base array's binding reads whole strides so they must lie within the bufferView it's a view of.
+        auto baseBegin = static_cast<const uint8_t*>(baseArray->dataPointer());
+        auto baseEnd = baseBegin + count * stride;
+        auto bufferView_itr = std::find_if(vsg_bufferViews.begin(), vsg_bufferViews.end(), [&](const vsg::ref_ptr<vsg::Data>& bufferView) {
+            if (!bufferView) return false;
+            auto begin = static_cast<const uint8_t*>(bufferView->dataPointer());
+            return baseBegin >= begin && baseEnd <= begin + bufferView->dataSize();
+        });
+        if (bufferView_itr == vsg_bufferViews.end()) continue;
+
+        // later arrays with an attribute within the first stride of the base array are read from the same binding.
+        for (size_t ai = pi + 1; ai < perVertexArrays.size(); ++ai)
+        {
+            size_t index = perVertexArrays[ai];
+            auto& array = vertexArrays[index];
+            if (bindingArrays[index] != index || array->properties.stride != stride || array->valueCount() != count) continue;
+
+            auto begin = static_cast<const uint8_t*>(array->dataPointer());
+            if (begin < baseBegin || begin + array->valueSize() > baseBegin + stride) continue;
+
+            bindingArrays[index] = base;
+            offsets[index] = static_cast<uint32_t>(begin - baseBegin);
+            interleaved = true;
+        }
+    }
+
+    if (!interleaved) return;
+
+    // renumber the remaining bindings and point each attribute at its binding and offset.
+    vsg::DataList arrays;
+    std::vector<VkVertexInputBindingDescription> bindingDescriptions;
+    std::vector<uint32_t> bindings(numArrays, 0);
+    for (size_t i = 0; i < numArrays; ++i)
+    {
+        if (bindingArrays[i] != i) continue;
+
+        bindings[i] = config.baseAttributeBinding + static_cast<uint32_t>(arrays.size());
+
+        auto bindingDescription = vertexInputState->vertexBindingDescriptions[i];
+        bindingDescription.binding = bindings[i];
+        bindingDescriptions.push_back(bindingDescription);
+
+        arrays.push_back(vertexArrays[i]);
+    }
+
+    for (size_t i = 0; i < numArrays; ++i)
+    {
+        auto& attributeDescription = vertexInputState->vertexAttributeDescriptions[i];
+        attributeDescription.binding = bindings[bindingArrays[i]];
+        attributeDescription.offset = offsets[i];
+    }
+
+    vertexInputState->vertexBindingDescriptions = bindingDescriptions;
+    vertexArrays = arrays;
+}
+
+vsg::ref_ptr<vsg::Node> gltf::Builder::createClusters(vsg::ref_ptr<vsg::Data> indices, const vsg::DataList& vertexArrays)
+{
+    // cluster bounds are computed from float positions, quantized positions are drawn as a single primitive.
+    auto positions = vertexArrays.front().cast<vsg::vec3Array>();
+    if (!positions || clusterSize == 0 || indices->valueCount() / 3 <= clusterSize) return {};
+
+    // the indices may be shared with other primitives so reorder a copy of them.
+    std::vector<TriangleCluster> clusters;
+    vsg::ref_ptr<vsg::Data> clusteredIndices;
+    if (auto ushort_indices = indices.cast<vsg::ushortArray>())
+    {
+        auto copy = vsg::ushortArray::create(ushort_indices->size());
+        std::copy(ushort_indices->begin(), ushort_indices->end(), copy->begin());
+        clusters = clusterTriangles(copy->data(), copy->size(), *positions, clusterSize);
+        clusteredIndices = copy;
+    }
+    else if (auto uint_indices = indices.cast<vsg::uintArray>())
+    {
+        auto copy = vsg::uintArray::create(uint_indices->size());
+        std::copy(uint_indices->begin(), uint_indices->end(), copy->begin());
+        clusters = clusterTriangles(copy->data(), copy->size(), *positions, clusterSize);
+        clusteredIndices = copy;
+    }
+
+    if (clusters.empty()) return {};
+
+    // the vertex arrays and indices are bound once, with each cluster's draw culled against its own bounding sphere.
+    auto group = vsg::Group::create();
+    group->addChild(vsg::BindVertexBuffers::create(0, vertexArrays));
+    group->addChild(vsg::BindIndexBuffer::create(clusteredIndices));
+    for (auto& cluster : clusters)
+    {
+        auto drawIndexed = vsg::DrawIndexed::create(cluster.indexCount, 1, cluster.firstIndex, 0, 0);
+        group->addChild(vsg::CullNode::create(cluster.bound, drawIndexed));
+    }
+
+    return group;
+}
+
+vsg::ref_ptr<vsg::Node> gltf::Builder::createMesh(vsg::ref_ptr<gltf::Mesh> gltf_mesh, const MeshExtras& meshExtras)
+{
+    /*
+    struct Attributes : public vsg::Inherit<vsg::JSONParser::Schema, Attributes>
+    {
+        std::map<std::string, glTFid> values;
+    };
+
+    struct Primitive : public vsg::Inherit<ExtensionsExtras, Primitive>
+    {
+        Attributes attributes;
+        glTFid indices;
+        glTFid material;
+        uint32_t mode = 0;
+        vsg::ObjectsSchema<Attributes> targets;
+    };
+
+    struct Mesh : public vsg::Inherit<NameExtensionsExtras, Mesh>
+    {
+        vsg::ObjectsSchema<Primitive> primitives;
+        vsg::ValuesSchema<double> weights;
+    };
+*/
+
+    const VkPrimitiveTopology topologyLookup[] = {
+        VK_PRIMITIVE_TOPOLOGY_POINT_LIST,     // 0, POINTS
+        VK_PRIMITIVE_TOPOLOGY_LINE_LIST,      // 1, LINES
+        VK_PRIMITIVE_TOPOLOGY_LINE_LIST,      // 2, LINE_LOOP, need special handling
+        VK_PRIMITIVE_TOPOLOGY_LINE_STRIP,     // 3, LINE_STRIP
+        VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST,  // 4, TRIANGLES
+        VK_PRIMITIVE_TOPOLOGY_TRIANGLE_STRIP, // 5, TRIANGLE_STRIP
+        VK_PRIMITIVE_TOPOLOGY_TRIANGLE_FAN    // 6, TRIANGLE_FAN
+    };
+#if 0
+    vsg::info("mesh = {");
+    vsg::info("    primitives = ", gltf_mesh->primitives.values.size());
+    vsg::info("    weight = ", gltf_mesh->weights.values.size());
+#endif
+
+    // meshes automatically instanced by instanceSharedMeshes() take their translations, rotations and scales from a vsg::InstanceNode.
+    int meshInstanceNodeHint = meshExtras.instanceNode ? (vsg::Options::INSTANCE_TRANSLATIONS | vsg::Options::INSTANCE_ROTATIONS | vsg::Options::INSTANCE_SCALES) : instanceNodeHint;
+
+    std::vector<vsg::ref_ptr<vsg::Node>> nodes;
+
+    for (auto& primitive : gltf_mesh->primitives.values)
+    {
+        vsg::ref_ptr<vsg::DescriptorConfigurator> vsg_material;
+        if (primitive->material)
+        {
+            vsg_material = vsg_materials[primitive->material.value];
+        }
+        else
+        {
+            vsg::debug("Material for primitive not assigned, primitive = ", primitive, ", primitive->material = ", primitive->material);
+            vsg_material = default_material;
+        }
+
+        auto config = vsg::GraphicsPipelineConfigurator::create(vsg_material->shaderSet);
+        config->descriptorConfigurator = vsg_material;
+        if (options) config->assignInheritedState(options->inheritedState);
+
+        if (meshExtras.jointSampler)
+        {
+            vsg_material->assignDescriptor("jointMatrices", meshExtras.jointSampler->jointMatrices);
+        }
+
+#if 0
+        vsg::info("    primitive = {");
+        vsg::info("        attributes = {");
+        for(auto& [semantic, id] : primitive->attributes.values)
+        {
+             vsg::info("            ", semantic, ", ", id);
+        }
+        vsg::info("        }");
+        vsg::info("        indices = ", primitive->indices);
+        vsg::info("        material = ", primitive->material);
+        vsg::info("        mode = ", primitive->mode);
+        vsg::info("        targets = ", primitive->targets.values.size()) ;
+
+        vsg::info("        * topology = ", topologyLookup[primitive->mode]) ;
+        if (primitive->mode==2) vsg::info("        * LINE_LOOP needs special handling.");
+
+        vsg::info("    }");
+#endif
+
+        vsg::DataList vertexArrays;
+        std::vector<size_t> perVertexArrays;
+
+        auto assignArray = [&](Attributes& attrib, VkVertexInputRate vertexInputRate, const std::string& attribute_name) -> bool {
+            auto array_itr = attrib.values.find(attribute_name);
+            if (array_itr == attrib.values.end()) return false;
+
+            auto name_itr = attributeLookup.find(attribute_name);
+            if (name_itr == attributeLookup.end()) return false;
+
+            if (array_itr->second.value >= vsg_accessors.size())
+            {
+                vsg::warn("gltf::Builder::createMesh() error in assignArray( attrib, vertexIndexRate", attribute_name, "), array index out of range.");
+                return false;
+            }
+
+            vsg::ref_ptr<vsg::Data> array = vsg_accessors[array_itr->second.value];
+            if (!array)
+            {
+                vsg::warn("gltf::Builder::createMesh() error in assignArray( attrib, vertexIndexRate", attribute_name, "), required array null.");
+                return false;
+            }
+
+            bool texCoord = attribute_name.compare(0, 9, "TEXCOORD_") == 0;
+            if (texCoord || attribute_name == "POSITION" || attribute_name == "NORMAL" || attribute_name == "COLOR_0")
+            {
+                // KHR_mesh_quantization attributes are either bound with formats that Vulkan dequantizes on vertex fetch, or converted to float.
+                auto& gltf_accessor = model->accessors.values[array_itr->second.value];
+                if (gltf_accessor->componentType != COMPONENT_TYPE_FLOAT && gltf_accessor->componentType != COMPONENT_TYPE_DOUBLE)
+                {
+                    bool transformTexCoords = texCoord && vsg_material->getObject<KHR_texture_transform>("KHR_texture_transform");
+                    if (quantizedAttributes && !transformTexCoords)
+                        array = assignQuantizedFormat(array, gltf_accessor->normalized, attribute_name == "POSITION" || attribute_name == "NORMAL");
+                    else
+                        array = dequantize(array, gltf_accessor->normalized);
+                }
+            }
+
+            if (attribute_name == "ROTATION")
+            {
+                if (auto vec4Rotations = array.cast<vsg::vec4Array>())
+                {
+                    auto quatArray = vsg::quatArray::create(array, 0, 12, vec4Rotations->size());
+                    array = quatArray;
+                }
+            }
+            else if (attribute_name == "TEXCOORD_0" || attribute_name == "TEXCOORD_1" || attribute_name == "TEXCOORD_2" || attribute_name == "TEXCOORD_3")
+            {
+                if (auto texture_transform = vsg_material->getObject<KHR_texture_transform>("KHR_texture_transform"))
+                {
+                    vsg::vec2 offset(0.0f, 0.0f);
+                    vsg::vec2 scale(1.0f, 1.0f);
+                    float rotation = texture_transform->rotation;
+                    if (texture_transform->offset.values.size() >= 2) offset.set(texture_transform->offset.values[0], texture_transform->offset.values[1]);
+                    if (texture_transform->scale.values.size() >= 2) scale.set(texture_transform->scale.values[0], texture_transform->scale.values[1]);
+
+                    if (auto texCoords = array.cast<vsg::vec2Array>())
+                    {
+                        float sin_rotation = std::sin(rotation);
+                        float cos_rotation = std::cos(rotation);
+                        auto transformedTexCoords = vsg::vec2Array::create(texCoords->size());
+                        auto dest_itr = transformedTexCoords->begin();
+                        for (auto& tc : *texCoords)
+                        {
+                            auto& dest_tc = *(dest_itr++);
+                            dest_tc.x = offset.x + (tc.x * scale.x) * cos_rotation + (tc.y * scale.y) * sin_rotation;
+                            dest_tc.y = offset.y + (tc.y * scale.y) * cos_rotation - (tc.x * scale.x) * sin_rotation;
+                        }
+                        array = transformedTexCoords;
+                    }
+                }
+            }
+            else if (attribute_name == "JOINTS_0")
+            {
+                if (auto ushortCoords = array.cast<vsg::usvec4Array>())
+                {
+                    auto intCoords = vsg::ivec4Array::create(ushortCoords->size());
+                    auto dest_itr = intCoords->begin();
+                    for (auto& usc : *ushortCoords)
+                    {
+                        *(dest_itr++) = vsg::ivec4(usc[0], usc[1], usc[2], usc[3]);
+                    }
+
+                    array = intCoords;
+                }
+                else if (auto ubyteCoords = array.cast<vsg::ubvec4Array>())
+                {
+                    auto intCoords = vsg::ivec4Array::create(ubyteCoords->size());
+                    auto dest_itr = intCoords->begin();
+                    for (auto& ubc : *ubyteCoords)
+                    {
+                        *(dest_itr++) = vsg::ivec4(ubc[0], ubc[1], ubc[2], ubc[3]);
+                    }
+
+                    array = intCoords;
+                }
+            }
+
+            if (compressVertices)
+            {
+                // accessors are compressed up front by compressAccessors(), transformed texture coordinates are unique to this primitive so are compressed here.
+                if (array == vsg_accessors[array_itr->second.value])
+                {
+                    if (auto& compressed = vsg_compressedAccessors[array_itr->second.value]) array = compressed;
+                }
+                else if (texCoord)
+                {
+                    if (auto compressed = compressTexCoords(*array)) array = compressed;
+                }
+            }
+
+            size_t index = vertexArrays.size();
+            config->assignArray(vertexArrays, name_itr->second, vertexInputRate, array);
+            if (vertexInputRate == VK_VERTEX_INPUT_RATE_VERTEX && vertexArrays.size() > index) perVertexArrays.push_back(index);
+            return true;
+        };
+
+        if (!assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "POSITION"))
+        {
+            vsg::warn("gltf::Builder::createMesh() error no vertex array assigned.");
+            return {};
+        }
+
+        if (!assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "NORMAL"))
+        {
+            auto normal = vsg::vec3Value::create(vsg::vec3(0.0f, 0.0f, 1.0f));
+            config->assignArray(vertexArrays, "vsg_Normal", VK_VERTEX_INPUT_RATE_INSTANCE, normal);
+        }
+
+        if (!assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "TEXCOORD_0"))
+        {
+            auto texcoord = vsg::vec2Value::create(vsg::vec2(0.0f, 0.0f));
+            config->assignArray(vertexArrays, "vsg_TexCoord0", VK_VERTEX_INPUT_RATE_INSTANCE, texcoord);
+        }
+
+        assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "TEXCOORD_1");
+        assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "TEXCOORD_2");
+        assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "TEXCOORD_3");
+
+        uint32_t vertexCount = static_cast<uint32_t>(vertexArrays.front()->valueCount());
+        uint32_t instanceCount = 1;
+        if (meshExtras.instancedAttributes)
+        {
+            for (auto& [name, id] : meshExtras.instancedAttributes->values)
+            {
+                instanceCount = static_cast<uint32_t>(vsg_accessors[id.value]->valueCount());
+            }
+        }
+
+        if (!assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "COLOR_0"))
+        {
+            if (meshInstanceNodeHint == vsg::Options::INSTANCE_NONE)
+            {
+                auto defaultColor = vsg::vec4Array::create(instanceCount, vsg::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+                config->assignArray(vertexArrays, "vsg_Color", VK_VERTEX_INPUT_RATE_INSTANCE, defaultColor);
+            }
+            else if ((meshInstanceNodeHint & vsg::Options::INSTANCE_COLORS) == 0)
+            {
+                auto defaultColor = vsg::vec4Array::create(vertexCount, vsg::vec4(1.0f, 1.0f, 1.0f, 1.0f));
+                if (config->assignArray(vertexArrays, "vsg_Color", VK_VERTEX_INPUT_RATE_VERTEX, defaultColor)) perVertexArrays.push_back(vertexArrays.size() - 1);
+            }
+        }
+
+        if (meshExtras.jointSampler)
+        {
+            bool jointsAssigned = false;
+            if (packedJoints)
+            {
+                auto joints_itr = primitive->attributes.values.find("JOINTS_0");
+                auto weights_itr = primitive->attributes.values.find("WEIGHTS_0");
+                if (joints_itr != primitive->attributes.values.end() && weights_itr != primitive->attributes.values.end() &&
+                    joints_itr->second.value < vsg_accessors.size() && weights_itr->second.value < vsg_accessors.size() &&
+                    vsg_accessors[joints_itr->second.value] && vsg_accessors[weights_itr->second.value])
+                {
+                    // primitives often share their joints and weights accessors so reuse previously packed arrays.
+                    auto key = std::make_pair(joints_itr->second.value, weights_itr->second.value);
+                    auto& packed = vsg_packedJoints[key];
+                    if (!packed.first)
+                    {
+                        bool weights16bit = model->accessors.values[weights_itr->second.value]->componentType == COMPONENT_TYPE_UNSIGNED_SHORT;
+                        packJoints(*vsg_accessors[key.first], *vsg_accessors[key.second], weights16bit, packed.first, packed.second);
+                    }
+
+                    if (packed.first && packed.second)
+                    {
+                        auto assignPackedArray = [&](const std::string& name, vsg::ref_ptr<vsg::Data> array) {
+                            size_t index = vertexArrays.size();
+                            config->assignArray(vertexArrays, name, VK_VERTEX_INPUT_RATE_VERTEX, array);
+                            if (vertexArrays.size() > index) perVertexArrays.push_back(index);
+                        };
+
+                        assignPackedArray("vsg_JointIndices", packed.first);
+                        assignPackedArray("vsg_JointWeights", packed.second);
+                        jointsAssigned = true;
+                    }
+                }
+            }
+
+            if (!jointsAssigned)
+            {
+                assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "JOINTS_0");
+                assignArray(primitive->attributes, VK_VERTEX_INPUT_RATE_VERTEX, "WEIGHTS_0");
+            }
+        }
+
+        if (meshExtras.instancedAttributes)
+        {
+            assignArray(*meshExtras.instancedAttributes, VK_VERTEX_INPUT_RATE_INSTANCE, "TRANSLATION");
+            assignArray(*meshExtras.instancedAttributes, VK_VERTEX_INPUT_RATE_INSTANCE, "ROTATION");
+            assignArray(*meshExtras.instancedAttributes, VK_VERTEX_INPUT_RATE_INSTANCE, "SCALE");
+        }
+
+        vsg::ref_ptr<vsg::Data> indices;
+        if (primitive->indices)
+        {
+            indices = vsg_accessors[primitive->indices.value];
+            if (!indices)
+            {
+                vsg::warn("gltf::Builder::createMesh() error required indices array null.");
+                return {};
+            }
+
+            indices = processIndices(indices, primitive->mode, vertexArrays, perVertexArrays);
+        }
+
+        // InstanceNode arrays are bound after the mesh's own bindings so leave those layouts alone.
+        if (interleavedVertices && (meshExtras.instancedAttributes || meshInstanceNodeHint == vsg::Options::INSTANCE_NONE))
+        {
+            interleaveArrays(*config, vertexArrays, perVertexArrays);
+        }
+
+        vsg::ref_ptr<vsg::Node> draw;
+
+        // large static opaque triangle lists are split into clusters that are culled individually, skinned vertices move away from the clusters' bounds.
+        bool clusteredDraw = clusterSize > 0 && culling && primitive->indices && primitive->mode == 4 && !vsg_material->blending &&
+                             !meshExtras.jointSampler && !meshExtras.instancedAttributes && meshInstanceNodeHint == vsg::Options::INSTANCE_NONE;
+
+        if (!meshExtras.instancedAttributes && meshInstanceNodeHint != vsg::Options::INSTANCE_NONE)
+        {
+            if ((meshInstanceNodeHint & vsg::Options::INSTANCE_COLORS) != 0) config->enableArray("vsg_Color", VK_VERTEX_INPUT_RATE_INSTANCE, 16, VK_FORMAT_R32G32B32A32_SFLOAT);
+            if ((meshInstanceNodeHint & vsg::Options::INSTANCE_TRANSLATIONS) != 0) config->enableArray("vsg_Translation", VK_VERTEX_INPUT_RATE_INSTANCE, 12, VK_FORMAT_R32G32B32_SFLOAT);
+            if ((meshInstanceNodeHint & vsg::Options::INSTANCE_ROTATIONS) != 0) config->enableArray("vsg_Rotation", VK_VERTEX_INPUT_RATE_INSTANCE, 16, VK_FORMAT_R32G32B32A32_SFLOAT);
+            if ((meshInstanceNodeHint & vsg::Options::INSTANCE_SCALES) != 0) config->enableArray("vsg_Scale", VK_VERTEX_INPUT_RATE_INSTANCE, 12, VK_FORMAT_R32G32B32_SFLOAT);
+
+            if (primitive->indices)
+            {
+                auto instanceDrawIndexed = vsg::InstanceDrawIndexed::create();
+                assign_extras(*primitive, *instanceDrawIndexed);
+                instanceDrawIndexed->assignArrays(vertexArrays);
+                instanceDrawIndexed->assignIndices(indices);
+                instanceDrawIndexed->indexCount = static_cast<uint32_t>(indices->valueCount());
+                draw = instanceDrawIndexed;
+            }
+            else
+            {
+                auto instanceDraw = vsg::InstanceDraw::create();
+                assign_extras(*primitive, *instanceDraw);
+                instanceDraw->assignArrays(vertexArrays);
+                instanceDraw->vertexCount = vertexCount;
+                draw = instanceDraw;
+            }
+        }
+        else if (auto clusters = clusteredDraw ? createClusters(indices, vertexArrays) : vsg::ref_ptr<vsg::Node>())
+        {
+            assign_extras(*primitive, *clusters);
+            draw = clusters;
+        }
+        else if (primitive->indices)
+        {
+            auto vid = vsg::VertexIndexDraw::create();
+            assign_extras(*primitive, *vid);
+            vid->assignArrays(vertexArrays);
+            vid->instanceCount = instanceCount;
+            vid->assignIndices(indices);
+            vid->indexCount = static_cast<uint32_t>(indices->valueCount());
+            draw = vid;
+        }
+        else
+        {
+            auto vd = vsg::VertexDraw::create();
+            assign_extras(*primitive, *vd);
+            vd->assignArrays(vertexArrays);
+            vd->instanceCount = instanceCount;
+            vd->vertexCount = vertexCount;
+            draw = vd;
+        }
+
+        // set the GraphicsPipelineStates to the required values.
+        struct SetPipelineStates : public vsg::Visitor
+        {
+            VkPrimitiveTopology topology = VK_PRIMITIVE_TOPOLOGY_TRIANGLE_LIST;
+            bool blending = false;
+            bool two_sided = false;
+
+            SetPipelineStates(VkPrimitiveTopology in_topology, bool in_blending, bool in_two_sided) :
+                topology(in_topology), blending(in_blending), two_sided(in_two_sided) {}
+
+            void apply(vsg::Object& object) { object.traverse(*this); }
+            void apply(vsg::RasterizationState& rs)
+            {
+                if (two_sided) rs.cullMode = VK_CULL_MODE_NONE;
+            }
+            void apply(vsg::InputAssemblyState& ias) { ias.topology = topology; }
+            void apply(vsg::ColorBlendState& cbs) { cbs.configureAttachments(blending); }
+
+        } sps(topologyLookup[primitive->mode], vsg_material->blending, vsg_material->two_sided);
+
+        config->accept(sps);
+
+        if (sharedObjects)
+            sharedObjects->share(config, [](auto gpc) { gpc->init(); });
+        else
+            config->init();
+
+        // create StateGroup as the root of the scene/command graph to hold the GraphicsPipeline, and binding of Descriptors to decorate the whole graph
+        auto stateGroup = vsg::StateGroup::create();
+
+        config->copyTo(stateGroup, sharedObjects);
+
+        stateGroup->addChild(draw);
+
+        // bounds from the POSITION accessor's min/max, expanded to cover all the instances of EXT_mesh_gpu_instancing meshes, so no vertex scan is required.
+        vsg::dbox bounds;
+        bool hasBounds = getPrimitiveBounds(*primitive, bounds);
+        if (hasBounds && meshExtras.instancedAttributes) hasBounds = getInstancedBounds(*meshExtras.instancedAttributes, bounds);
+
+        if (vsg_material->blending)
+        {
+            if (meshExtras.instancedAttributes || meshInstanceNodeHint != vsg::Options::INSTANCE_NONE)
+            {
+#if 0
+                auto layer = vsg::Layer::create();
+                layer->binNumber = 10;
+                layer->child = stateGroup;
+
+                nodes.push_back(layer);
+#else
+                nodes.push_back(stateGroup);
+#endif
+            }
+            else
+            {
+                if (!hasBounds)
+                {
+                    vsg::ComputeBounds computeBounds;
+                    draw->accept(computeBounds);
+                    bounds = computeBounds.bounds;
+                }
+
+                vsg::dvec3 center = (bounds.min + bounds.max) * 0.5;
+                double radius = vsg::length(bounds.max - bounds.min) * 0.5;
+
+                auto depthSorted = vsg::DepthSorted::create();
+                depthSorted->binNumber = 10;
+                depthSorted->bound.set(center[0], center[1], center[2], radius);
+                depthSorted->child = stateGroup;
+
+                nodes.push_back(depthSorted);
+            }
+        }
+        else
+        {
+            nodes.push_back(stateGroup);
+        }
+    }
+
+    if (nodes.empty())
+    {
+        vsg::warn("Empty mesh");
+        return {};
+    }
+
+    vsg::ref_ptr<vsg::Node> vsg_mesh;
+    if (nodes.size() == 1)
+    {
+        // vsg::info("Mesh with single primtiive");
+        vsg_mesh = nodes.front();
+    }
+    else
+    {
+        // vsg::info("Mesh with multiple primtiives - could possible use vsg::Geomterty.");
+        auto group = vsg::Group::create();
+        for (auto node : nodes)
+        {
+            group->addChild(node);
+        }
+
+        vsg_mesh = group;
+    }
+
+    // cull the mesh as a whole from its accessor bounds, skinned vertices move away from their bind pose so skinned meshes aren't culled.
+    if (culling && !meshExtras.jointSampler && !meshExtras.instancedAttributes && meshInstanceNodeHint == vsg::Options::INSTANCE_NONE)
+    {
+        vsg::dbox meshBounds;
+        if (getMeshBounds(*gltf_mesh, meshBounds))
+        {
+            vsg::dsphere bs((meshBounds.max + meshBounds.min) * 0.5, vsg::length(meshBounds.max - meshBounds.min) * 0.5);
+            vsg_mesh = vsg::CullNode::create(bs, vsg_mesh);
+        }
+    }
+
+    assign_name_extras(*gltf_mesh, *vsg_mesh);
+
+    return vsg_mesh;
+}
+
+bool gltf::Builder::getTransform(gltf::Node& node, vsg::dmat4& matrix)
+{
+    if (node.matrix.values.size() == 16)
+    {
+        auto& m = node.matrix.values;
+        matrix.set(m[0], m[1], m[2], m[3],
+                   m[4], m[5], m[6], m[7],
+                   m[8], m[9], m[10], m[11],
+                   m[12], m[13], m[14], m[15]);
+        return true;
+    }
+    else if (!(node.translation.values.empty()) ||
+             !(node.rotation.values.empty()) ||
+             !(node.scale.values.empty()))
+    {
+        auto& t = node.translation.values;
+        auto& r = node.rotation.values;
+        auto& s = node.scale.values;
+
+        vsg::dvec3 vsg_t(0.0, 0.0, 0.0);
+        vsg::dquat vsg_r;
+        vsg::dvec3 vsg_s(1.0, 1.0, 1.0);
+
+        if (t.size() >= 3) vsg_t.set(t[0], t[1], t[2]);
+        if (r.size() >= 4) vsg_r.set(r[0], r[1], r[2], r[3]);
+        if (s.size() >= 3) vsg_s.set(s[0], s[1], s[2]);
+
+        matrix = vsg::translate(vsg_t) * vsg::rotate(vsg_r) * vsg::scale(vsg_s);
+        return true;
+    }
+    else
+    {
+        return false;
+    }
+}
+
+vsg::ref_ptr<vsg::Light> gltf::Builder::createLight(vsg::ref_ptr<gltf::Light> gltf_light)
+{
+    bool range_set = gltf_light->range != std::numeric_limits<float>::max();
+
+    vsg::ref_ptr<vsg::Light> vsg_light;
+    if (gltf_light->type == "directional")
+    {
+        auto directionalLight = vsg::DirectionalLight::create();
+        vsg_light = directionalLight;
+    }
+    else if (gltf_light->type == "point")
+    {
+        auto pointLight = vsg::PointLight::create();
+        if (range_set) pointLight->radius = gltf_light->range;
+        vsg_light = pointLight;
+    }
+    else if (gltf_light->type == "spot")
+    {
+        auto spotLight = vsg::SpotLight::create();
+        if (range_set) spotLight->radius = gltf_light->range;
+        vsg_light = spotLight;
+        if (gltf_light->spot)
+        {
+            spotLight->innerAngle = gltf_light->spot->innerConeAngle;
+            spotLight->outerAngle = gltf_light->spot->outerConeAngle;
+        }
+    }
+    else
+    {
+        return {};
+    }
+
+    vsg_light->name = gltf_light->name;
+    vsg_light->intensity = gltf_light->intensity;
+    if (gltf_light->color.values.size() >= 3) vsg_light->color.set(gltf_light->color.values[0], gltf_light->color.values[1], gltf_light->color.values[2]);
+
+    return vsg_light;
+}
+
+namespace
+{
+    // value of linearly interpolated keys at time, keys must be sorted by time.
+    template<class K, class Lerp>
+    auto interpolateKeys(const std::vector<K>& keys, double time, Lerp lerp)
+    {
+        if (time <= keys.front().time) return keys.front().value;
+        if (time >= keys.back().time) return keys.back().value;
+
+        auto upper = std::upper_bound(keys.begin(), keys.end(), time, [](double t, const K& key) { return t < key.time; });
+        auto lower = upper - 1;
+        double delta = upper->time - lower->time;
+        double r = delta > 0.0 ? (time - lower->time) / delta : 0.0;
+        return lerp(lower->value, upper->value, r);
+    }
+
+    // replace keys with ones sampled at a uniform time step from the first to the last key.
+    template<class K, class Lerp>
+    void resampleKeys(std::vector<K>& keys, double step, Lerp lerp)
+    {
+        if (keys.size() < 2 || step <= 0.0) return;
+
+        double startTime = keys.front().time;
+        double endTime = keys.back().time;
+        size_t count = static_cast<size_t>(std::ceil((endTime - startTime) / step - 1e-6)) + 1;
+
+        std::vector<K> resampled(count);
+        for (size_t i = 0; i < count; ++i)
+        {
+            double time = std::min(startTime + static_cast<double>(i) * step, endTime);
+            resampled[i].time = time;
+            resampled[i].value = interpolateKeys(keys, time, lerp);
+        }
+        keys.swap(resampled);
+    }
+
+    // collapse constant channels to a single key and remove the keys that interpolating between their neighbours reconstructs within tolerance.
+    // When keepUniform is true only constant channels are collapsed, so resampled keys keep their uniform time step.
+    template<class K, class Lerp, class Error>
+    void compactKeys(std::vector<K>& keys, double tolerance, bool keepUniform, Lerp lerp, Error error)
+    {
+        if (keys.size() < 2) return;
+
+        bool constant = true;
+        for (auto& key : keys)
+        {
+            if (error(keys.front().value, key.value) > tolerance)
+            {
+                constant = false;
+                break;
+            }
+        }
+
+        if (constant)
+        {
+            keys.resize(1);
+            return;
+        }
+
+        if (keepUniform) return;
+
+        // greedily extend each segment for as long as the skipped keys stay within tolerance, limiting the span so long channels stay linear time.
+        const size_t maxSpan = 256;
+
+        std::vector<K> compacted;
+        compacted.push_back(keys.front());
+
+        size_t anchor = 0;
+        while (anchor + 1 < keys.size())
+        {
+            size_t end = anchor + 1;
+            while (end + 1 < keys.size() && (end + 1 - anchor) <= maxSpan)
+            {
+                size_t candidate = end + 1;
+                double delta = keys[candidate].time - keys[anchor].time;
+
+                bool withinTolerance = true;
+                for (size_t k = anchor + 1; k < candidate && withinTolerance; ++k)
+                {
+                    double r = delta > 0.0 ? (keys[k].time - keys[anchor].time) / delta : 0.0;
+                    withinTolerance = error(lerp(keys[anchor].value, keys[candidate].value, r), keys[k].value) <= tolerance;
+                }
+
+                if (!withinTolerance) break;
+                end = candidate;
+            }
+
+            compacted.push_back(keys[end]);
+            anchor = end;
+        }
+
+        keys.swap(compacted);
+    }
+} // namespace
+
+vsg::ref_ptr<vsg::Animation> gltf::Builder::createAnimation(vsg::ref_ptr<gltf::Animation> gltf_animation)
+{
+    vsg::LogOutput log;
+
+    auto vsg_animation = vsg::Animation::create();
+    vsg_animation->name = gltf_animation->name;
+
+    // gltf_animation->report(log);
+
+    struct NodeChannels
+    {
+        vsg::ref_ptr<AnimationChannel> translation;
+        vsg::ref_ptr<AnimationChannel> rotation;
+        vsg::ref_ptr<AnimationChannel> scale;
+        vsg::ref_ptr<AnimationChannel> weights;
+    };
+
+    std::map<uint32_t, NodeChannels> nodeChannels;
+
+    for (auto& channel : gltf_animation->channels.values)
+    {
+        auto node_id = channel->target.node.value;
+
+        if (channel->target.path == "translation")
+            nodeChannels[node_id].translation = channel;
+        else if (channel->target.path == "rotation")
+            nodeChannels[node_id].rotation = channel;
+        else if (channel->target.path == "scale")
+            nodeChannels[node_id].scale = channel;
+        else if (channel->target.path == "weights")
+            nodeChannels[node_id].weights = channel;
+        else
+            vsg::warn("gltf::Builder::createAnimation() unsupported AnimationChannel.target.path of ", channel->target.path);
+    }
+
+    for (auto& [node_id, channels] : nodeChannels)
+    {
+        if (channels.translation || channels.rotation || channels.scale)
+        {
+            auto keyframes = vsg::TransformKeyframes::create();
+
+            if (channels.translation)
+            {
+                auto samplerID = channels.translation->sampler.value;
+                auto sampler = gltf_animation->samplers.values[samplerID];
+                auto vsg_input = vsg_accessors[sampler->input.value];
+                auto vsg_output = vsg_accessors[sampler->output.value];
+
+                auto timeValues = vsg_input.cast<vsg::floatArray>();
+                auto translationValues = vsg_output.cast<vsg::vec3Array>();
+
+                if (timeValues && translationValues)
+                {
+                    size_t count = std::min(vsg_input->valueCount(), vsg_output->valueCount());
+
+                    auto& translations = keyframes->positions;
+                    translations.resize(count);
+
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        const auto& t = translationValues->at(i);
+                        translations[i].time = timeValues->at(i);
+                        translations[i].value.set(t.x, t.y, t.z);
+                    }
+                }
+                else
+                {
+                    vsg::warn("gltf::Builder::createAnimation(..) unsupported translation types. vsg_input = ", vsg_input, ", vsg_output = ", vsg_output);
+                }
+            }
+
+            if (channels.rotation)
+            {
+                auto samplerID = channels.rotation->sampler.value;
+                auto sampler = gltf_animation->samplers.values[samplerID];
+                auto vsg_input = vsg_accessors[sampler->input.value];
+                auto vsg_output = vsg_accessors[sampler->output.value];
+
+                auto timeValues = vsg_input.cast<vsg::floatArray>();
+                auto rotationValues = vsg_output.cast<vsg::vec4Array>();
+
+                if (timeValues && rotationValues)
+                {
+                    size_t count = std::min(vsg_input->valueCount(), vsg_output->valueCount());
+
+                    auto& rotations = keyframes->rotations;
+                    rotations.resize(count);
+
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        const auto& q = rotationValues->at(i);
+                        rotations[i].time = timeValues->at(i);
+                        rotations[i].value.set(q.x, q.y, q.z, q.w);
+                    }
+                }
+                else
+                {
+                    vsg::warn("gltf::Builder::createAnimation(..) unsupported rotation types. vsg_input = ", vsg_input, ", vsg_output = ", vsg_output);
+                }
+            }
+
+            if (channels.scale)
+            {
+                auto samplerID = channels.scale->sampler.value;
+                auto sampler = gltf_animation->samplers.values[samplerID];
+                auto vsg_input = vsg_accessors[sampler->input.value];
+                auto vsg_output = vsg_accessors[sampler->output.value];
+
+                auto timeValues = vsg_input.cast<vsg::floatArray>();
+                auto scaleValues = vsg_output.cast<vsg::vec3Array>();
+
+                if (timeValues && scaleValues)
+                {
+                    size_t count = std::min(vsg_input->valueCount(), vsg_output->valueCount());
+
+                    auto& scales = keyframes->scales;
+                    scales.resize(count);
+
+                    for (size_t i = 0; i < count; ++i)
+                    {
+                        const auto& s = scaleValues->at(i);
+                        scales[i].time = timeValues->at(i);
+                        scales[i].value.set(s.x, s.y, s.z);
+                    }
+                }
+                else
+                {
+                    vsg::warn("gltf::Builder::createAnimation(..) unsupported scale types. vsg_input = ", vsg_input, ", vsg_output = ", vsg_output);
+                }
+            }
+
+            if (animationTolerance > 0.0f || animationSampleRate > 0.0f)
+            {
+                auto vectorLerp = [](const vsg::dvec3& a, const vsg::dvec3& b, double r) { return vsg::mix(a, b, r); };
+                auto vectorError = [](const vsg::dvec3& a, const vsg::dvec3& b) { return vsg::length(a - b); };
+                auto quatLerp = [](const vsg::dquat& a, const vsg::dquat& b, double r) { return vsg::mix(a, b, r); };
+                auto quatError = [](const vsg::dquat& a, const vsg::dquat& b) {
+                    double d = std::abs(a.x * b.x + a.y * b.y + a.z * b.z + a.w * b.w);
+                    return 2.0 * std::acos(std::min(d, 1.0));
+                };
+
+                // only LINEAR samplers can be resampled or compacted, STEP and CUBICSPLINE keys are left as authored.
+                auto linear = [&](vsg::ref_ptr<AnimationChannel> channel) {
+                    if (!channel) return false;
+                    auto& interpolation = gltf_animation->samplers.values[channel->sampler.value]->interpolation;
+                    return interpolation.empty() || interpolation == "LINEAR";
+                };
+
+                double step = animationSampleRate > 0.0f ? 1.0 / static_cast<double>(animationSampleRate) : 0.0;
+                bool keepUniform = step > 0.0;
+                double tolerance = static_cast<double>(animationTolerance);
+
+                if (linear(channels.translation))
+                {
+                    resampleKeys(keyframes->positions, step, vectorLerp);
+                    if (tolerance > 0.0) compactKeys(keyframes->positions, tolerance, keepUniform, vectorLerp, vectorError);
+                }
+                if (linear(channels.rotation))
+                {
+                    resampleKeys(keyframes->rotations, step, quatLerp);
+                    if (tolerance > 0.0) compactKeys(keyframes->rotations, tolerance, keepUniform, quatLerp, quatError);
+                }
+                if (linear(channels.scale))
+                {
+                    resampleKeys(keyframes->scales, step, vectorLerp);
+                    if (tolerance > 0.0) compactKeys(keyframes->scales, tolerance, keepUniform, vectorLerp, vectorError);
+                }
+
+                keyframes->positions.shrink_to_fit();
+                keyframes->rotations.shrink_to_fit();
+                keyframes->scales.shrink_to_fit();
+            }
+
+            auto transformSampler = vsg::TransformSampler::create();
+
+            auto node = vsg_nodes[node_id];
+            if (auto mt = node.cast<vsg::MatrixTransform>())
+            {
+                vsg::decompose(mt->matrix, transformSampler->position, transformSampler->rotation, transformSampler->scale);
+            }
+            else if (auto joint = node.cast<vsg::Joint>())
+            {
+                vsg::decompose(joint->matrix, transformSampler->position, transformSampler->rotation, transformSampler->scale);
+            }
+
+            transformSampler->keyframes = keyframes;
+            transformSampler->object = vsg_nodes[node_id];
+
+            vsg_animation->samplers.push_back(transformSampler);
+        }
+    }
+
+    return vsg_animation;
+}
+
+vsg::ref_ptr<vsg::Node> gltf::Builder::createNode(vsg::ref_ptr<gltf::Node> gltf_node, bool jointNode)
+{
+    vsg::ref_ptr<vsg::Node> vsg_node;
+
+    vsg::ref_ptr<vsg::Light> vsg_light;
+    if (auto khr_lights = gltf_node->extension<KHR_lights_punctual>("KHR_lights_punctual"))
     {
-        auto& m = node.matrix.values;
-        matrix.set(m[0], m[1], m[2], m[3],
-                   m[4], m[5], m[6], m[7],
-                   m[8], m[9], m[10], m[11],
-                   m[12], m[13], m[14], m[15]);
-        return true;
+        auto id = khr_lights->light;
+        if (id && id.value < vsg_lights.size())
+        {
+            vsg_light = vsg_lights[id.value];
+        }
     }
-    else if (!(node.translation.values.empty()) ||
-             !(node.rotation.values.empty()) ||
-             !(node.scale.values.empty()))
+
+    MeshExtras meshExtras;
+
+    if (gltf_node->skin)
     {
-        auto& t = node.translation.values;
-        auto& r = node.rotation.values;
-        auto& s = node.scale.values;
+        meshExtras.jointSampler = vsg_skins[gltf_node->skin.value];
+    }
+
+    vsg::ref_ptr<vsg::Node> vsg_mesh;
+    if (gltf_node->mesh)
+    {
+        vsg_mesh = vsg_meshes[gltf_node->mesh.value];
+        auto gltf_mesh = model->meshes.values[gltf_node->mesh.value];
+
+        if (auto mesh_gpu_instancing = gltf_node->extension<EXT_mesh_gpu_instancing>("EXT_mesh_gpu_instancing"))
+        {
+            meshExtras.instancedAttributes = mesh_gpu_instancing->attributes;
+        }
+
+        if (!vsg_meshes[gltf_node->mesh.value])
+        {
+            vsg_meshes[gltf_node->mesh.value] = createMesh(gltf_mesh, meshExtras);
+        }
+
+        vsg_mesh = vsg_meshes[gltf_node->mesh.value];
+    }
+
+    bool isTransform = !(gltf_node->matrix.values.empty()) ||
+                       !(gltf_node->rotation.values.empty()) ||
+                       !(gltf_node->scale.values.empty()) ||
+                       !(gltf_node->translation.values.empty());
+
+    size_t numChildren = gltf_node->children.values.size();
+    if (gltf_node->camera) ++numChildren;
+    if (vsg_mesh) ++numChildren;
+    if (vsg_light) ++numChildren;
+
+    if (jointNode)
+    {
+        auto joint = vsg::Joint::create();
+        if (gltf_node->camera) joint->addChild(vsg_cameras[gltf_node->camera.value]);
+        if (vsg_light) joint->addChild(vsg_light);
+        if (vsg_mesh) joint->addChild(vsg_mesh);
+
+        if (gltf_node->matrix.values.size() == 16)
+        {
+            auto& m = gltf_node->matrix.values;
+            joint->matrix.set(m[0], m[1], m[2], m[3],
+                              m[4], m[5], m[6], m[7],
+                              m[8], m[9], m[10], m[11],
+                              m[12], m[13], m[14], m[15]);
+        }
+        else
+        {
+            auto& t = gltf_node->translation.values;
+            auto& r = gltf_node->rotation.values;
+            auto& s = gltf_node->scale.values;
+
+            vsg::dvec3 vsg_t(0.0, 0.0, 0.0);
+            vsg::dquat vsg_r;
+            vsg::dvec3 vsg_s(1.0, 1.0, 1.0);
+
+            if (t.size() >= 3) vsg_t.set(t[0], t[1], t[2]);
+            if (r.size() >= 4) vsg_r.set(r[0], r[1], r[2], r[3]);
+            if (s.size() >= 3) vsg_s.set(s[0], s[1], s[2]);
+
+            joint->matrix = vsg::translate(vsg_t) * vsg::rotate(vsg_r) * vsg::scale(vsg_s);
+        }
+
+        vsg_node = joint;
+    }
+    else if (isTransform)
+    {
+        auto transform = vsg::MatrixTransform::create();
+        if (gltf_node->camera) transform->addChild(vsg_cameras[gltf_node->camera.value]);
+        if (vsg_light) transform->addChild(vsg_light);
+        if (vsg_mesh) transform->addChild(vsg_mesh);
+
+        if (gltf_node->matrix.values.size() == 16)
+        {
+            auto& m = gltf_node->matrix.values;
+            transform->matrix.set(m[0], m[1], m[2], m[3],
+                                  m[4], m[5], m[6], m[7],
+                                  m[8], m[9], m[10], m[11],
+                                  m[12], m[13], m[14], m[15]);
+        }
+        else
+        {
+            auto& t = gltf_node->translation.values;
+            auto& r = gltf_node->rotation.values;
+            auto& s = gltf_node->scale.values;
+
+            vsg::dvec3 vsg_t(0.0, 0.0, 0.0);
+            vsg::dquat vsg_r;
+            vsg::dvec3 vsg_s(1.0, 1.0, 1.0);
+
+            if (t.size() >= 3) vsg_t.set(t[0], t[1], t[2]);
+            if (r.size() >= 4) vsg_r.set(r[0], r[1], r[2], r[3]);
+            if (s.size() >= 3) vsg_s.set(s[0], s[1], s[2]);
+
+            transform->matrix = vsg::translate(vsg_t) * vsg::rotate(vsg_r) * vsg::scale(vsg_s);
+        }
+
+        vsg_node = transform;
+    }
+    else if (numChildren > 1 || gltf_node->requireMetaData())
+    {
+        auto group = vsg::Group::create();
+
+        if (gltf_node->camera) group->addChild(vsg_cameras[gltf_node->camera.value]);
+        if (vsg_light) group->addChild(vsg_light);
+        if (vsg_mesh) group->addChild(vsg_mesh);
+
+        vsg_node = group;
+    }
+    else
+    {
+        if (gltf_node->camera)
+            vsg_node = vsg_cameras[gltf_node->camera.value];
+        else if (vsg_mesh)
+            vsg_node = vsg_mesh;
+        else if (vsg_light)
+            vsg_node = vsg_light;
+        else
+            vsg_node = vsg::Group::create(); // TODO: single child so should this just point to the child?
+    }
+
+    assign_name_extras(*gltf_node, *vsg_node);
+
+    return vsg_node;
+}
+
+void gltf::Builder::flattenTransforms(gltf::Node& node, const vsg::dmat4& inheritedTransform)
+{
+    vsg::dmat4 accumulatedTransform = inheritedTransform;
+
+    vsg::dmat4 localMatrix;
+    if (getTransform(node, localMatrix))
+    {
+        accumulatedTransform = accumulatedTransform * localMatrix;
+
+        // clear node transform values so that they aren't reapplied.
+        node.matrix.values.clear();
+        node.rotation.values.clear();
+        node.scale.values.clear();
+        node.translation.values.clear();
+    }
+
+    if (node.camera)
+    {
+        vsg::info("TODO: need to flatten camera ", node.camera);
+    }
+
+    if (node.skin)
+    {
+        vsg::info("TODO: need to flatten skin ", node.skin);
+    }
+
+    auto inverse_accumulatedTransform = vsg::inverse(accumulatedTransform);
 
-        vsg::dvec3 vsg_t(0.0, 0.0, 0.0);
-        vsg::dquat vsg_r;
-        vsg::dvec3 vsg_s(1.0, 1.0, 1.0);
+    if (node.mesh)
+    {
+        auto mesh = model->meshes.values[node.mesh.value];
+        for (auto primitive : mesh->primitives.values)
+        {
+            if (auto position_itr = primitive->attributes.values.find("POSITION"); position_itr != primitive->attributes.values.end())
+            {
+                auto& data = vsg_accessors[position_itr->second.value];
+                if (data && !data.cast<vsg::vec3Array>()) data = dequantize(data, model->accessors.values[position_itr->second.value]->normalized);
 
-        if (t.size() >= 3) vsg_t.set(t[0], t[1], t[2]);
-        if (r.size() >= 4) vsg_r.set(r[0], r[1], r[2], r[3]);
-        if (s.size() >= 3) vsg_s.set(s[0], s[1], s[2]);
+                if (auto vertices = data.cast<vsg::vec3Array>())
+                {
+                    for (auto& v : *vertices)
+                    {
+                        v = accumulatedTransform * vsg::dvec3(v);
+                    }
+                }
+            }
+            if (auto normal_itr = primitive->attributes.values.find("NORMAL"); normal_itr != primitive->attributes.values.end())
+            {
+                auto& data = vsg_accessors[normal_itr->second.value];
+                if (data && !data.cast<vsg::vec3Array>()) data = dequantize(data, model->accessors.values[normal_itr->second.value]->normalized);
 
-        matrix = vsg::translate(vsg_t) * vsg::rotate(vsg_r) * vsg::scale(vsg_s);
-        return true;
+                if (auto normals = data.cast<vsg::vec3Array>())
+                {
+                    for (auto& n : *normals)
+                    {
+                        n = vsg::dvec3(n) * inverse_accumulatedTransform;
+                    }
+                }
+            }
+        }
     }
-    else
+
+    for (auto& id : node.children.values)
     {
-        return false;
+        auto child = model->nodes.values[id.value];
+        flattenTransforms(*child, accumulatedTransform);
     }
 }
 
-vsg::ref_ptr<vsg::Light> gltf::Builder::createLight(vsg::ref_ptr<gltf::Light> gltf_light)
+namespace
 {
-    bool range_set = gltf_light->range != std::numeric_limits<float>::max();
-
-    vsg::ref_ptr<vsg::Light> vsg_light;
-    if (gltf_light->type == "directional")
-    {
-        auto directionalLight = vsg::DirectionalLight::create();
-        vsg_light = directionalLight;
-    }
-    else if (gltf_light->type == "point")
+    template<class A, typename T>
+    vsg::ref_ptr<A> createArrayFrom(const std::vector<T>& values)
     {
-        auto pointLight = vsg::PointLight::create();
-        if (range_set) pointLight->radius = gltf_light->range;
-        vsg_light = pointLight;
+        auto array = A::create(static_cast<uint32_t>(values.size()));
+        std::copy(values.begin(), values.end(), array->begin());
+        return array;
     }
-    else if (gltf_light->type == "spot")
+
+    // nodes that are animated, or are joints of skins, must keep their own transforms.
+    std::vector<bool> findDynamicNodes(const gltf::glTF& model)
     {
-        auto spotLight = vsg::SpotLight::create();
-        if (range_set) spotLight->radius = gltf_light->range;
-        vsg_light = spotLight;
-        if (gltf_light->spot)
+        std::vector<bool> dynamicNodes(model.nodes.values.size(), false);
+        for (auto& gltf_animation : model.animations.values)
         {
-            spotLight->innerAngle = gltf_light->spot->innerConeAngle;
-            spotLight->outerAngle = gltf_light->spot->outerConeAngle;
+            for (auto& channel : gltf_animation->channels.values)
+            {
+                if (channel->target.node && channel->target.node.value < dynamicNodes.size()) dynamicNodes[channel->target.node.value] = true;
+            }
         }
+        for (auto& gltf_skin : model.skins.values)
+        {
+            if (!gltf_skin) continue;
+            for (auto& joint : gltf_skin->joints.values)
+            {
+                if (joint.value < dynamicNodes.size()) dynamicNodes[joint.value] = true;
+            }
+        }
+        return dynamicNodes;
     }
-    else
-    {
-        return {};
-    }
-
-    vsg_light->name = gltf_light->name;
-    vsg_light->intensity = gltf_light->intensity;
-    if (gltf_light->color.values.size() >= 3) vsg_light->color.set(gltf_light->color.values[0], gltf_light->color.values[1], gltf_light->color.values[2]);
-
-    return vsg_light;
-}
+} // namespace
 
-vsg::ref_ptr<vsg::Animation> gltf::Builder::createAnimation(vsg::ref_ptr<gltf::Animation> gltf_animation)
+void gltf::Builder::bakeStaticTransforms()
 {
-    vsg::LogOutput log;
+    auto dynamicNodes = findDynamicNodes(*model);
+    size_t numNodes = model->nodes.values.size();
 
-    auto vsg_animation = vsg::Animation::create();
-    vsg_animation->name = gltf_animation->name;
+    // a node's transform can only be removed when no node below it is animated or skinned, as these need the transforms above them at runtime.
+    std::vector<int> pinned(numNodes, -1);
+    std::function<bool(uint32_t)> isPinned = [&](uint32_t ni) -> bool {
+        if (ni >= numNodes || !model->nodes.values[ni]) return false;
+        if (pinned[ni] >= 0) return pinned[ni] == 1;
 
-    // gltf_animation->report(log);
+        pinned[ni] = 0; // guard against cyclic node graphs
+        auto& gltf_node = model->nodes.values[ni];
+        bool result = dynamicNodes[ni] || gltf_node->skin;
+        for (auto& child : gltf_node->children.values)
+        {
+            if (isPinned(child.value)) result = true;
+        }
+        pinned[ni] = result ? 1 : 0;
+        return result;
+    };
 
-    struct NodeChannels
+    // vertex data can only be baked in place when the mesh, and the POSITION/NORMAL/TANGENT accessors it uses, aren't shared with any other node.
+    std::vector<uint32_t> meshUses(model->meshes.values.size(), 0);
+    for (auto& gltf_node : model->nodes.values)
     {
-        vsg::ref_ptr<AnimationChannel> translation;
-        vsg::ref_ptr<AnimationChannel> rotation;
-        vsg::ref_ptr<AnimationChannel> scale;
-        vsg::ref_ptr<AnimationChannel> weights;
-    };
+        if (gltf_node && gltf_node->mesh && gltf_node->mesh.value < meshUses.size()) ++meshUses[gltf_node->mesh.value];
+    }
 
-    std::map<uint32_t, NodeChannels> nodeChannels;
+    static const char* bakedAttributes[] = {"POSITION", "NORMAL", "TANGENT"};
 
-    for (auto& channel : gltf_animation->channels.values)
+    std::vector<uint32_t> accessorUses(model->accessors.values.size(), 0);
+    for (auto& gltf_mesh : model->meshes.values)
     {
-        auto node_id = channel->target.node.value;
+        if (!gltf_mesh) continue;
 
-        if (channel->target.path == "translation")
-            nodeChannels[node_id].translation = channel;
-        else if (channel->target.path == "rotation")
-            nodeChannels[node_id].rotation = channel;
-        else if (channel->target.path == "scale")
-            nodeChannels[node_id].scale = channel;
-        else if (channel->target.path == "weights")
-            nodeChannels[node_id].weights = channel;
-        else
-            vsg::warn("gltf::Builder::createAnimation() unsupported AnimationChannel.target.path of ", channel->target.path);
+        std::set<uint32_t> meshAccessors;
+        for (auto& primitive : gltf_mesh->primitives.values)
+        {
+            for (auto& [name, id] : primitive->attributes.values) meshAccessors.insert(id.value);
+            for (auto& target : primitive->targets.values)
+            {
+                for (auto& [name, id] : target->values) meshAccessors.insert(id.value);
+            }
+        }
+        for (auto ai : meshAccessors)
+        {
+            if (ai < accessorUses.size()) ++accessorUses[ai];
+        }
     }
 
-    for (auto& [node_id, channels] : nodeChannels)
-    {
-        if (channels.translation || channels.rotation || channels.scale)
-        {
-            auto keyframes = vsg::TransformKeyframes::create();
+    auto bakeMesh = [&](gltf::Node& gltf_node, const vsg::dmat4& matrix) -> bool {
+        if (gltf_node.mesh.value >= meshUses.size() || meshUses[gltf_node.mesh.value] != 1) return false;
+        if (!gltf_node.weights.values.empty() || gltf_node.extension<EXT_mesh_gpu_instancing>("EXT_mesh_gpu_instancing")) return false;
 
-            if (channels.translation)
+        // mirroring transforms would require the triangle winding to be flipped as well, so leave these as transforms.
+        if (vsg::determinant(matrix) <= 0.0) return false;
+
+        auto& gltf_mesh = model->meshes.values[gltf_node.mesh.value];
+        if (!gltf_mesh || !gltf_mesh->weights.values.empty()) return false;
+
+        std::map<uint32_t, std::string> accessors;
+        for (auto& primitive : gltf_mesh->primitives.values)
+        {
+            if (!primitive->targets.values.empty()) return false;
+            for (auto name : bakedAttributes)
             {
-                auto samplerID = channels.translation->sampler.value;
-                auto sampler = gltf_animation->samplers.values[samplerID];
-                auto vsg_input = vsg_accessors[sampler->input.value];
-                auto vsg_output = vsg_accessors[sampler->output.value];
+                auto itr = primitive->attributes.values.find(name);
+                if (itr == primitive->attributes.values.end()) continue;
 
-                auto timeValues = vsg_input.cast<vsg::floatArray>();
-                auto translationValues = vsg_output.cast<vsg::vec3Array>();
+                auto ai = itr->second.value;
+                if (ai >= vsg_accessors.size() || accessorUses[ai] != 1 || !vsg_accessors[ai]) return false;
+                accessors[ai] = name;
+            }
+        }
 
-                if (timeValues && translationValues)
-                {
-                    size_t count = std::min(vsg_input->valueCount(), vsg_output->valueCount());
+        auto inverse = vsg::inverse(matrix);
 
-                    auto& translations = keyframes->positions;
-                    translations.resize(count);
+        // the transformed arrays are float, so KHR_mesh_quantization accessors must no longer be treated as normalized, or getBounds() would rescale their min/max.
+        auto replaceAccessor = [&](uint32_t ai, vsg::ref_ptr<vsg::Data> dest) {
+            auto& gltf_accessor = model->accessors.values[ai];
+            gltf_accessor->componentType = COMPONENT_TYPE_FLOAT;
+            gltf_accessor->normalized = false;
+            vsg_accessors[ai] = dest;
+        };
 
-                    for (size_t i = 0; i < count; ++i)
-                    {
-                        const auto& t = translationValues->at(i);
-                        translations[i].time = timeValues->at(i);
-                        translations[i].value.set(t.x, t.y, t.z);
-                    }
+        for (auto& [ai, name] : accessors)
+        {
+            // write the transformed values to new arrays rather than in place, as the source arrays may reference memory mapped or shared buffers.
+            auto& gltf_accessor = model->accessors.values[ai];
+            auto data = dequantize(vsg_accessors[ai], gltf_accessor->normalized);
+
+            if (auto vertices = data.cast<vsg::vec3Array>(); vertices && name == "POSITION")
+            {
+                auto dest = vsg::vec3Array::create(static_cast<uint32_t>(vertices->size()));
+                auto dest_itr = dest->begin();
+                vsg::dbox bounds;
+                for (auto& v : *vertices)
+                {
+                    auto tv = matrix * vsg::dvec3(v);
+                    bounds.add(tv);
+                    *(dest_itr++) = vsg::vec3(tv);
                 }
-                else
+
+                if (bounds.valid())
                 {
-                    vsg::warn("gltf::Builder::createAnimation(..) unsupported translation types. vsg_input = ", vsg_input, ", vsg_output = ", vsg_output);
+                    gltf_accessor->min.values = {bounds.min.x, bounds.min.y, bounds.min.z};
+                    gltf_accessor->max.values = {bounds.max.x, bounds.max.y, bounds.max.z};
                 }
+                replaceAccessor(ai, dest);
             }
-
-            if (channels.rotation)
+            else if (auto normals = data.cast<vsg::vec3Array>(); normals && name == "NORMAL")
             {
-                auto samplerID = channels.rotation->sampler.value;
-                auto sampler = gltf_animation->samplers.values[samplerID];
-                auto vsg_input = vsg_accessors[sampler->input.value];
-                auto vsg_output = vsg_accessors[sampler->output.value];
+                auto dest = vsg::vec3Array::create(static_cast<uint32_t>(normals->size()));
+                auto dest_itr = dest->begin();
+                for (auto& n : *normals) *(dest_itr++) = vsg::vec3(vsg::normalize(vsg::dvec3(n) * inverse));
+                replaceAccessor(ai, dest);
+            }
+            else if (auto tangents = data.cast<vsg::vec4Array>(); tangents && name == "TANGENT")
+            {
+                auto dest = vsg::vec4Array::create(static_cast<uint32_t>(tangents->size()));
+                auto dest_itr = dest->begin();
+                for (auto& t : *tangents)
+                {
+                    auto d = matrix * vsg::dvec4(t.x, t.y, t.z, 0.0);
+                    auto direction = vsg::normalize(vsg::dvec3(d.x, d.y, d.z));
+                    *(dest_itr++) = vsg::vec4(static_cast<float>(direction.x), static_cast<float>(direction.y), static_cast<float>(direction.z), t.w);
+                }
+                replaceAccessor(ai, dest);
+            }
+        }
 
-                auto timeValues = vsg_input.cast<vsg::floatArray>();
-                auto rotationValues = vsg_output.cast<vsg::vec4Array>();
+        return true;
+    };
 
-                if (timeValues && rotationValues)
-                {
-                    size_t count = std::min(vsg_input->valueCount(), vsg_output->valueCount());
+    std::function<void(uint32_t, const vsg::dmat4&)> bake = [&](uint32_t ni, const vsg::dmat4& inheritedTransform) {
+        if (ni >= numNodes || !model->nodes.values[ni]) return;
+        auto& gltf_node = *model->nodes.values[ni];
 
-                    auto& rotations = keyframes->rotations;
-                    rotations.resize(count);
+        if (isPinned(ni))
+        {
+            // transforms above a pinned node have all been retained, so its children start again from the identity.
+            for (auto& child : gltf_node.children.values) bake(child.value, vsg::dmat4());
+            return;
+        }
 
-                    for (size_t i = 0; i < count; ++i)
-                    {
-                        const auto& q = rotationValues->at(i);
-                        rotations[i].time = timeValues->at(i);
-                        rotations[i].value.set(q.x, q.y, q.z, q.w);
-                    }
-                }
-                else
-                {
-                    vsg::warn("gltf::Builder::createAnimation(..) unsupported rotation types. vsg_input = ", vsg_input, ", vsg_output = ", vsg_output);
-                }
+        vsg::dmat4 accumulatedTransform = inheritedTransform;
+        vsg::dmat4 localMatrix;
+        if (getTransform(gltf_node, localMatrix)) accumulatedTransform = accumulatedTransform * localMatrix;
+
+        gltf_node.matrix.values.clear();
+        gltf_node.rotation.values.clear();
+        gltf_node.scale.values.clear();
+        gltf_node.translation.values.clear();
+
+        bool hasTransformedContent = gltf_node.camera || gltf_node.extension<KHR_lights_punctual>("KHR_lights_punctual");
+        if (gltf_node.mesh && !bakeMesh(gltf_node, accumulatedTransform)) hasTransformedContent = true;
+
+        if (hasTransformedContent && accumulatedTransform != vsg::dmat4())
+        {
+            // cameras, lights and meshes that can't be baked keep the accumulated transform on their own node, its children are relative to it.
+            auto& m = accumulatedTransform;
+            gltf_node.matrix.values = {m[0][0], m[0][1], m[0][2], m[0][3],
+                                       m[1][0], m[1][1], m[1][2], m[1][3],
+                                       m[2][0], m[2][1], m[2][2], m[2][3],
+                                       m[3][0], m[3][1], m[3][2], m[3][3]};
+            accumulatedTransform = vsg::dmat4();
+        }
+
+        for (auto& child : gltf_node.children.values) bake(child.value, accumulatedTransform);
+    };
+
+    for (auto& gltf_scene : model->scenes.values)
+    {
+        if (!gltf_scene) continue;
+        for (auto& id : gltf_scene->nodes.values) bake(id.value, vsg::dmat4());
+    }
+}
+
+void gltf::Builder::mergeStaticGeometry()
+{
+    // nodes that are animated, or are joints of skins, must keep their own transforms so they and their children aren't merged.
+    auto dynamicNodes = findDynamicNodes(*model);
+
+    // float versions of the vertex attributes that createMesh() uses, shared between all the nodes that reference a primitive.
+    struct MergeablePrimitive
+    {
+        vsg::ref_ptr<vsg::vec3Array> vertices;
+        vsg::ref_ptr<vsg::vec3Array> normals;
+        vsg::ref_ptr<vsg::vec2Array> texcoords[4];
+        vsg::ref_ptr<vsg::vec4Array> colors;
+        std::vector<uint32_t> indices;
+        std::string signature;
+    };
+
+    std::map<gltf::Primitive*, std::shared_ptr<MergeablePrimitive>> mergeablePrimitives;
+
+    auto getMergeablePrimitive = [&](gltf::Primitive& primitive) -> std::shared_ptr<MergeablePrimitive> {
+        if (auto itr = mergeablePrimitives.find(&primitive); itr != mergeablePrimitives.end()) return itr->second;
+
+        auto& mp = mergeablePrimitives[&primitive];
+
+        if (primitive.mode != 4 || !primitive.targets.values.empty()) return mp;
+        if (primitive.material && model->materials.values[primitive.material.value]->alphaMode == "BLEND") return mp;
+
+        auto getArray = [&](const std::string& name) -> vsg::ref_ptr<vsg::Data> {
+            auto itr = primitive.attributes.values.find(name);
+            if (itr == primitive.attributes.values.end() || itr->second.value >= vsg_accessors.size()) return {};
+            auto& array = vsg_accessors[itr->second.value];
+            return array ? dequantize(array, model->accessors.values[itr->second.value]->normalized) : array;
+        };
+
+        auto candidate = std::make_shared<MergeablePrimitive>();
+        candidate->vertices = getArray("POSITION").cast<vsg::vec3Array>();
+        if (!candidate->vertices) return mp;
+
+        size_t vertexCount = candidate->vertices->size();
+        candidate->signature = "POSITION";
+
+        if (auto array = getArray("NORMAL"))
+        {
+            candidate->normals = array.cast<vsg::vec3Array>();
+            if (!candidate->normals || candidate->normals->size() != vertexCount) return mp;
+            candidate->signature += ",NORMAL";
+        }
+
+        for (int i = 0; i < 4; ++i)
+        {
+            auto name = "TEXCOORD_" + std::to_string(i);
+            if (auto array = getArray(name))
+            {
+                candidate->texcoords[i] = array.cast<vsg::vec2Array>();
+                if (!candidate->texcoords[i] || candidate->texcoords[i]->size() != vertexCount) return mp;
+                candidate->signature += "," + name;
             }
+        }
 
-            if (channels.scale)
+        if (auto array = getArray("COLOR_0"))
+        {
+            if (auto rgb = array.cast<vsg::vec3Array>())
             {
-                auto samplerID = channels.scale->sampler.value;
-                auto sampler = gltf_animation->samplers.values[samplerID];
-                auto vsg_input = vsg_accessors[sampler->input.value];
-                auto vsg_output = vsg_accessors[sampler->output.value];
+                candidate->colors = vsg::vec4Array::create(rgb->size());
+                auto dest_itr = candidate->colors->begin();
+                for (auto& c : *rgb) *(dest_itr++) = vsg::vec4(c.r, c.g, c.b, 1.0f);
+            }
+            else
+            {
+                candidate->colors = array.cast<vsg::vec4Array>();
+            }
+            if (!candidate->colors || candidate->colors->size() != vertexCount) return mp;
+            candidate->signature += ",COLOR_0";
+        }
 
-                auto timeValues = vsg_input.cast<vsg::floatArray>();
-                auto scaleValues = vsg_output.cast<vsg::vec3Array>();
+        if (primitive.indices)
+        {
+            auto array = primitive.indices.value < vsg_accessors.size() ? vsg_accessors[primitive.indices.value] : vsg::ref_ptr<vsg::Data>();
+            if (auto ubyte_indices = array.cast<vsg::ubyteArray>())
+                candidate->indices.assign(ubyte_indices->begin(), ubyte_indices->end());
+            else if (auto ushort_indices = array.cast<vsg::ushortArray>())
+                candidate->indices.assign(ushort_indices->begin(), ushort_indices->end());
+            else if (auto uint_indices = array.cast<vsg::uintArray>())
+                candidate->indices.assign(uint_indices->begin(), uint_indices->end());
+            else
+                return mp;
 
-                if (timeValues && scaleValues)
-                {
-                    size_t count = std::min(vsg_input->valueCount(), vsg_output->valueCount());
+            for (auto index : candidate->indices)
+            {
+                if (index >= vertexCount) return mp;
+            }
+        }
+        else
+        {
+            candidate->indices.resize(vertexCount);
+            for (size_t i = 0; i < vertexCount; ++i) candidate->indices[i] = static_cast<uint32_t>(i);
+        }
 
-                    auto& scales = keyframes->scales;
-                    scales.resize(count);
+        candidate->indices.resize(candidate->indices.size() - candidate->indices.size() % 3);
 
-                    for (size_t i = 0; i < count; ++i)
-                    {
-                        const auto& s = scaleValues->at(i);
-                        scales[i].time = timeValues->at(i);
-                        scales[i].value.set(s.x, s.y, s.z);
-                    }
-                }
-                else
-                {
-                    vsg::warn("gltf::Builder::createAnimation(..) unsupported scale types. vsg_input = ", vsg_input, ", vsg_output = ", vsg_output);
-                }
+        mp = candidate;
+        return mp;
+    };
+
+    // batches are limited in size so they can use 16bit indices, leaving 65535 for primitive restart, and remain small enough to be usefully culled,
+    // a single primitive with more vertices than this forms a batch of its own that keeps 32bit indices.
+    const size_t maxBatchVertices = 65535;
+
+    struct Batch
+    {
+        glTFid material;
+        std::string signature;
+        std::vector<vsg::vec3> vertices;
+        std::vector<vsg::vec3> normals;
+        std::vector<vsg::vec2> texcoords[4];
+        std::vector<vsg::vec4> colors;
+        std::vector<uint32_t> indices;
+        vsg::dbox bounds;
+    };
+
+    std::vector<bool> mergedMeshNodes(model->nodes.values.size(), false);
+
+    for (auto& gltf_scene : model->scenes.values)
+    {
+        std::map<std::pair<uint32_t, std::string>, std::vector<Batch>> batches;
+
+        auto appendPrimitive = [&](gltf::Primitive& primitive, MergeablePrimitive& mp, const vsg::dmat4& matrix) {
+            auto& batchList = batches[std::make_pair(primitive.material.value, mp.signature)];
+            size_t vertexCount = mp.vertices->size();
+            if (batchList.empty() || (!batchList.back().vertices.empty() && batchList.back().vertices.size() + vertexCount > maxBatchVertices))
+            {
+                batchList.emplace_back();
+                batchList.back().material = primitive.material;
+                batchList.back().signature = mp.signature;
             }
 
-            auto transformSampler = vsg::TransformSampler::create();
+            auto& batch = batchList.back();
+            uint32_t base = static_cast<uint32_t>(batch.vertices.size());
 
-            auto node = vsg_nodes[node_id];
-            if (auto mt = node.cast<vsg::MatrixTransform>())
+            for (auto& v : *mp.vertices)
             {
-                vsg::decompose(mt->matrix, transformSampler->position, transformSampler->rotation, transformSampler->scale);
+                auto tv = matrix * vsg::dvec3(v);
+                batch.vertices.push_back(vsg::vec3(tv));
+                batch.bounds.add(tv);
             }
-            else if (auto joint = node.cast<vsg::Joint>())
+
+            if (mp.normals)
             {
-                vsg::decompose(joint->matrix, transformSampler->position, transformSampler->rotation, transformSampler->scale);
+                auto inverse = vsg::inverse(matrix);
+                for (auto& n : *mp.normals) batch.normals.push_back(vsg::vec3(vsg::normalize(vsg::dvec3(n) * inverse)));
             }
 
-            transformSampler->keyframes = keyframes;
-            transformSampler->object = vsg_nodes[node_id];
+            for (int i = 0; i < 4; ++i)
+            {
+                if (mp.texcoords[i]) batch.texcoords[i].insert(batch.texcoords[i].end(), mp.texcoords[i]->begin(), mp.texcoords[i]->end());
+            }
 
-            vsg_animation->samplers.push_back(transformSampler);
-        }
-    }
+            if (mp.colors) batch.colors.insert(batch.colors.end(), mp.colors->begin(), mp.colors->end());
 
-    return vsg_animation;
-}
+            // mirroring transforms flip the winding of the triangles so swap the order to retain the front face.
+            bool flipWinding = vsg::determinant(matrix) < 0.0;
+            for (size_t i = 0; i < mp.indices.size(); i += 3)
+            {
+                batch.indices.push_back(base + mp.indices[i]);
+                batch.indices.push_back(base + mp.indices[flipWinding ? i + 2 : i + 1]);
+                batch.indices.push_back(base + mp.indices[flipWinding ? i + 1 : i + 2]);
+            }
+        };
 
-vsg::ref_ptr<vsg::Node> gltf::Builder::createNode(vsg::ref_ptr<gltf::Node> gltf_node, bool jointNode)
-{
-    vsg::ref_ptr<vsg::Node> vsg_node;
+        std::function<void(uint32_t, const vsg::dmat4&)> collect = [&](uint32_t ni, const vsg::dmat4& inheritedTransform) {
+            if (ni >= model->nodes.values.size() || dynamicNodes[ni]) return;
 
-    vsg::ref_ptr<vsg::Light> vsg_light;
-    if (auto khr_lights = gltf_node->extension<KHR_lights_punctual>("KHR_lights_punctual"))
-    {
-        auto id = khr_lights->light;
-        if (id && id.value < vsg_lights.size())
-        {
-            vsg_light = vsg_lights[id.value];
-        }
-    }
+            auto& gltf_node = model->nodes.values[ni];
 
-    MeshExtras meshExtras;
+            vsg::dmat4 accumulatedTransform = inheritedTransform;
+            vsg::dmat4 localMatrix;
+            if (getTransform(*gltf_node, localMatrix)) accumulatedTransform = accumulatedTransform * localMatrix;
 
-    if (gltf_node->skin)
-    {
-        meshExtras.jointSampler = vsg_skins[gltf_node->skin.value];
-    }
+            if (gltf_node->mesh && !gltf_node->skin && gltf_node->weights.values.empty() && !gltf_node->extension<EXT_mesh_gpu_instancing>("EXT_mesh_gpu_instancing"))
+            {
+                auto& gltf_mesh = model->meshes.values[gltf_node->mesh.value];
 
-    vsg::ref_ptr<vsg::Node> vsg_mesh;
-    if (gltf_node->mesh)
-    {
-        vsg_mesh = vsg_meshes[gltf_node->mesh.value];
-        auto gltf_mesh = model->meshes.values[gltf_node->mesh.value];
+                // only merge a node's mesh when all of its primitives can be merged.
+                std::vector<std::shared_ptr<MergeablePrimitive>> mps;
+                for (auto& primitive : gltf_mesh->primitives.values)
+                {
+                    auto mp = getMergeablePrimitive(*primitive);
+                    if (!mp) break;
+                    mps.push_back(mp);
+                }
 
-        if (auto mesh_gpu_instancing = gltf_node->extension<EXT_mesh_gpu_instancing>("EXT_mesh_gpu_instancing"))
+                if (!mps.empty() && mps.size() == gltf_mesh->primitives.values.size())
+                {
+                    for (size_t pi = 0; pi < mps.size(); ++pi)
+                    {
+                        appendPrimitive(*gltf_mesh->primitives.values[pi], *mps[pi], accumulatedTransform);
+                    }
+                    mergedMeshNodes[ni] = true;
+                }
+            }
+
+            for (auto& child : gltf_node->children.values)
+            {
+                collect(child.value, accumulatedTransform);
+            }
+        };
+
+        for (auto& id : gltf_scene->nodes.values)
         {
-            meshExtras.instancedAttributes = mesh_gpu_instancing->attributes;
+            collect(id.value, vsg::dmat4());
         }
 
-        if (!vsg_meshes[gltf_node->mesh.value])
+        // add each batch to the model as a new mesh, with its own node, so it's built by createMesh()/createNode() like any other.
+        auto addAccessor = [&](vsg::ref_ptr<vsg::Data> data, uint32_t componentType, const char* type) {
+            auto gltf_accessor = gltf::Accessor::create();
+            gltf_accessor->componentType = componentType;
+            gltf_accessor->type = type;
+            gltf_accessor->count = static_cast<uint32_t>(data->valueCount());
+            gltf_accessor->data = data;
+
+            glTFid id;
+            id.value = static_cast<uint32_t>(model->accessors.values.size());
+            model->accessors.values.push_back(gltf_accessor);
+            vsg_accessors.push_back(data);
+            return id;
+        };
+
+        for (auto& [key, batchList] : batches)
         {
-            vsg_meshes[gltf_node->mesh.value] = createMesh(gltf_mesh, meshExtras);
-        }
+            for (auto& batch : batchList)
+            {
+                if (batch.indices.empty()) continue;
 
-        vsg_mesh = vsg_meshes[gltf_node->mesh.value];
-    }
+                auto primitive = gltf::Primitive::create();
+                primitive->material = batch.material;
+                primitive->mode = 4;
 
-    bool isTransform = !(gltf_node->matrix.values.empty()) ||
-                       !(gltf_node->rotation.values.empty()) ||
-                       !(gltf_node->scale.values.empty()) ||
-                       !(gltf_node->translation.values.empty());
+                auto positionID = addAccessor(createArrayFrom<vsg::vec3Array>(batch.vertices), COMPONENT_TYPE_FLOAT, "VEC3");
+                auto& position_accessor = model->accessors.values[positionID.value];
+                position_accessor->min.values = {batch.bounds.min.x, batch.bounds.min.y, batch.bounds.min.z};
+                position_accessor->max.values = {batch.bounds.max.x, batch.bounds.max.y, batch.bounds.max.z};
+                primitive->attributes.values["POSITION"] = positionID;
 
-    size_t numChildren = gltf_node->children.values.size();
-    if (gltf_node->camera) ++numChildren;
-    if (vsg_mesh) ++numChildren;
-    if (vsg_light) ++numChildren;
+                if (!batch.normals.empty()) primitive->attributes.values["NORMAL"] = addAccessor(createArrayFrom<vsg::vec3Array>(batch.normals), COMPONENT_TYPE_FLOAT, "VEC3");
+                for (int i = 0; i < 4; ++i)
+                {
+                    if (!batch.texcoords[i].empty()) primitive->attributes.values["TEXCOORD_" + std::to_string(i)] = addAccessor(createArrayFrom<vsg::vec2Array>(batch.texcoords[i]), COMPONENT_TYPE_FLOAT, "VEC2");
+                }
+                if (!batch.colors.empty()) primitive->attributes.values["COLOR_0"] = addAccessor(createArrayFrom<vsg::vec4Array>(batch.colors), COMPONENT_TYPE_FLOAT, "VEC4");
 
-    if (jointNode)
-    {
-        auto joint = vsg::Joint::create();
-        if (gltf_node->camera) joint->addChild(vsg_cameras[gltf_node->camera.value]);
-        if (vsg_light) joint->addChild(vsg_light);
-        if (vsg_mesh) joint->addChild(vsg_mesh);
+                if (batch.vertices.size() <= maxBatchVertices)
+                    primitive->indices = addAccessor(createArrayFrom<vsg::ushortArray>(batch.indices), COMPONENT_TYPE_UNSIGNED_SHORT, "SCALAR");
+                else
+                    primitive->indices = addAccessor(createArrayFrom<vsg::uintArray>(batch.indices), COMPONENT_TYPE_UNSIGNED_INT, "SCALAR");
 
-        if (gltf_node->matrix.values.size() == 16)
-        {
-            auto& m = gltf_node->matrix.values;
-            joint->matrix.set(m[0], m[1], m[2], m[3],
-                              m[4], m[5], m[6], m[7],
-                              m[8], m[9], m[10], m[11],
-                              m[12], m[13], m[14], m[15]);
-        }
-        else
-        {
-            auto& t = gltf_node->translation.values;
-            auto& r = gltf_node->rotation.values;
-            auto& s = gltf_node->scale.values;
+                auto gltf_mesh = gltf::Mesh::create();
+                gltf_mesh->name = "merged geometry";
+                gltf_mesh->primitives.values.push_back(primitive);
 
-            vsg::dvec3 vsg_t(0.0, 0.0, 0.0);
-            vsg::dquat vsg_r;
-            vsg::dvec3 vsg_s(1.0, 1.0, 1.0);
+                auto gltf_node = gltf::Node::create();
+                gltf_node->mesh.value = static_cast<uint32_t>(model->meshes.values.size());
+                model->meshes.values.push_back(gltf_mesh);
 
-            if (t.size() >= 3) vsg_t.set(t[0], t[1], t[2]);
-            if (r.size() >= 4) vsg_r.set(r[0], r[1], r[2], r[3]);
-            if (s.size() >= 3) vsg_s.set(s[0], s[1], s[2]);
+                glTFid nodeID;
+                nodeID.value = static_cast<uint32_t>(model->nodes.values.size());
+                model->nodes.values.push_back(gltf_node);
+                gltf_scene->nodes.values.push_back(nodeID);
 
-            joint->matrix = vsg::translate(vsg_t) * vsg::rotate(vsg_r) * vsg::scale(vsg_s);
+            }
         }
+    }
 
-        vsg_node = joint;
+    // the merged nodes' meshes are now part of the batches so remove them from the original nodes.
+    for (size_t ni = 0; ni < mergedMeshNodes.size(); ++ni)
+    {
+        if (mergedMeshNodes[ni]) model->nodes.values[ni]->mesh = glTFid{};
     }
-    else if (isTransform)
+}
+
+void gltf::Builder::instanceSharedMeshes()
+{
+    auto dynamicNodes = findDynamicNodes(*model);
+    size_t numNodes = model->nodes.values.size();
+
+    struct Instance
     {
-        auto transform = vsg::MatrixTransform::create();
-        if (gltf_node->camera) transform->addChild(vsg_cameras[gltf_node->camera.value]);
-        if (vsg_light) transform->addChild(vsg_light);
-        if (vsg_mesh) transform->addChild(vsg_mesh);
+        uint32_t node;
+        vsg::dvec3 translation;
+        vsg::dquat rotation;
+        vsg::dvec3 scale;
+    };
 
-        if (gltf_node->matrix.values.size() == 16)
-        {
-            auto& m = gltf_node->matrix.values;
-            transform->matrix.set(m[0], m[1], m[2], m[3],
-                                  m[4], m[5], m[6], m[7],
-                                  m[8], m[9], m[10], m[11],
-                                  m[12], m[13], m[14], m[15]);
-        }
-        else
-        {
-            auto& t = gltf_node->translation.values;
-            auto& r = gltf_node->rotation.values;
-            auto& s = gltf_node->scale.values;
+    // per scene, the static nodes referencing each mesh along with the decomposed world transforms of those nodes.
+    std::vector<std::map<uint32_t, std::vector<Instance>>> sceneInstances(model->scenes.values.size());
 
-            vsg::dvec3 vsg_t(0.0, 0.0, 0.0);
-            vsg::dquat vsg_r;
-            vsg::dvec3 vsg_s(1.0, 1.0, 1.0);
+    // nodes reachable from more than one scene keep their meshes, as instancing removes the mesh from the node.
+    std::vector<uint32_t> sceneCount(numNodes, 0);
+    for (auto& gltf_scene : model->scenes.values)
+    {
+        if (!gltf_scene) continue;
+
+        std::vector<bool> visited(numNodes, false);
+        std::function<void(uint32_t)> count = [&](uint32_t ni) {
+            if (ni >= numNodes || !model->nodes.values[ni] || visited[ni]) return;
+            visited[ni] = true;
+            ++sceneCount[ni];
+            for (auto& child : model->nodes.values[ni]->children.values) count(child.value);
+        };
+        for (auto& id : gltf_scene->nodes.values) count(id.value);
+    }
 
-            if (t.size() >= 3) vsg_t.set(t[0], t[1], t[2]);
-            if (r.size() >= 4) vsg_r.set(r[0], r[1], r[2], r[3]);
-            if (s.size() >= 3) vsg_s.set(s[0], s[1], s[2]);
+    auto instanceable = [&](gltf::Node& gltf_node) -> bool {
+        if (!gltf_node.mesh || gltf_node.mesh.value >= model->meshes.values.size()) return false;
+        if (gltf_node.skin || !gltf_node.weights.values.empty() || gltf_node.extension<EXT_mesh_gpu_instancing>("EXT_mesh_gpu_instancing")) return false;
 
-            transform->matrix = vsg::translate(vsg_t) * vsg::rotate(vsg_r) * vsg::scale(vsg_s);
+        auto& gltf_mesh = model->meshes.values[gltf_node.mesh.value];
+        if (!gltf_mesh || !gltf_mesh->weights.values.empty()) return false;
+        for (auto& primitive : gltf_mesh->primitives.values)
+        {
+            if (!primitive->targets.values.empty()) return false;
         }
+        return true;
+    };
 
-        vsg_node = transform;
-    }
-    else if (numChildren > 1 || gltf_node->requireMetaData())
+    for (size_t sci = 0; sci < model->scenes.values.size(); ++sci)
     {
-        auto group = vsg::Group::create();
-
-        if (gltf_node->camera) group->addChild(vsg_cameras[gltf_node->camera.value]);
-        if (vsg_light) group->addChild(vsg_light);
-        if (vsg_mesh) group->addChild(vsg_mesh);
+        auto& gltf_scene = model->scenes.values[sci];
+        if (!gltf_scene) continue;
 
-        vsg_node = group;
-    }
-    else
-    {
-        if (gltf_node->camera)
-            vsg_node = vsg_cameras[gltf_node->camera.value];
-        else if (vsg_mesh)
-            vsg_node = vsg_mesh;
-        else if (vsg_light)
-            vsg_node = vsg_light;
-        else
-            vsg_node = vsg::Group::create(); // TODO: single child so should this just point to the child?
-    }
+        std::function<void(uint32_t, const vsg::dmat4&)> collect = [&](uint32_t ni, const vsg::dmat4& inheritedTransform) {
+            // nodes that move, and everything below them, don't have a fixed transform so can't be instanced.
+            if (ni >= numNodes || !model->nodes.values[ni] || dynamicNodes[ni] || sceneCount[ni] != 1) return;
 
-    assign_name_extras(*gltf_node, *vsg_node);
+            auto& gltf_node = model->nodes.values[ni];
 
-    return vsg_node;
-}
+            vsg::dmat4 accumulatedTransform = inheritedTransform;
+            vsg::dmat4 localMatrix;
+            if (getTransform(*gltf_node, localMatrix)) accumulatedTransform = accumulatedTransform * localMatrix;
 
-void gltf::Builder::flattenTransforms(gltf::Node& node, const vsg::dmat4& inheritedTransform)
-{
-    vsg::dmat4 accumulatedTransform = inheritedTransform;
+            Instance instance{ni, {}, {}, {}};
+            if (instanceable(*gltf_node) && vsg::determinant(accumulatedTransform) > 0.0 && vsg::decompose(accumulatedTransform, instance.translation, instance.rotation, instance.scale))
+            {
+                // InstanceNode can only represent translation, rotation and scale, so check that no shear was lost in the decomposition.
+                auto recomposed = vsg::translate(instance.translation) * vsg::rotate(instance.rotation) * vsg::scale(instance.scale);
 
-    vsg::dmat4 localMatrix;
-    if (getTransform(node, localMatrix))
-    {
-        accumulatedTransform = accumulatedTransform * localMatrix;
+                double maxDifference = 0.0, maxValue = 0.0;
+                for (int c = 0; c < 4; ++c)
+                {
+                    for (int r = 0; r < 4; ++r)
+                    {
+                        maxDifference = std::max(maxDifference, std::abs(recomposed[c][r] - accumulatedTransform[c][r]));
+                        maxValue = std::max(maxValue, std::abs(accumulatedTransform[c][r]));
+                    }
+                }
 
-        // clear node transform values so that they aren't reapplied.
-        node.matrix.values.clear();
-        node.rotation.values.clear();
-        node.scale.values.clear();
-        node.translation.values.clear();
-    }
+                if (maxDifference <= 1e-6 * std::max(maxValue, 1.0)) sceneInstances[sci][gltf_node->mesh.value].push_back(instance);
+            }
 
-    if (node.camera)
-    {
-        vsg::info("TODO: need to flatten camera ", node.camera);
-    }
+            for (auto& child : gltf_node->children.values) collect(child.value, accumulatedTransform);
+        };
 
-    if (node.skin)
-    {
-        vsg::info("TODO: need to flatten skin ", node.skin);
+        for (auto& id : gltf_scene->nodes.values) collect(id.value, vsg::dmat4());
     }
 
-    auto inverse_accumulatedTransform = vsg::inverse(accumulatedTransform);
-
-    if (node.mesh)
+    for (size_t sci = 0; sci < sceneInstances.size(); ++sci)
     {
-        auto mesh = model->meshes.values[node.mesh.value];
-        for (auto primitive : mesh->primitives.values)
+        for (auto& [mi, instances] : sceneInstances[sci])
         {
-            if (auto position_itr = primitive->attributes.values.find("POSITION"); position_itr != primitive->attributes.values.end())
-            {
-                auto data = vsg_accessors[position_itr->second.value];
-                auto vertices = data.cast<vsg::vec3Array>();
+            if (instances.size() < instanceThreshold) continue;
 
-                for (auto& v : *vertices)
+            vsg::dbox meshBounds;
+            for (auto& primitive : model->meshes.values[mi]->primitives.values)
+            {
+                vsg::dbox primitiveBounds;
+                auto position_itr = primitive->attributes.values.find("POSITION");
+                if (position_itr != primitive->attributes.values.end() && getBounds(*model->accessors.values[position_itr->second.value], primitiveBounds))
                 {
-                    v = accumulatedTransform * vsg::dvec3(v);
+                    meshBounds.add(primitiveBounds);
                 }
             }
-            if (auto normal_itr = primitive->attributes.values.find("NORMAL"); normal_itr != primitive->attributes.values.end())
+
+            uint32_t count = static_cast<uint32_t>(instances.size());
+
+            InstancedMesh instancedMesh;
+            instancedMesh.mesh.value = mi;
+            instancedMesh.translations = vsg::vec3Array::create(count);
+            instancedMesh.rotations = vsg::quatArray::create(count);
+            instancedMesh.scales = vsg::vec3Array::create(count);
+
+            for (uint32_t i = 0; i < count; ++i)
             {
-                auto data = vsg_accessors[normal_itr->second.value];
-                auto normals = data.cast<vsg::vec3Array>();
+                auto& instance = instances[i];
+                instancedMesh.translations->set(i, vsg::vec3(instance.translation));
+                instancedMesh.rotations->set(i, vsg::quat(instance.rotation));
+                instancedMesh.scales->set(i, vsg::vec3(instance.scale));
 
-                for (auto& n : *normals)
+                if (meshBounds.valid())
                 {
-                    n = vsg::dvec3(n) * inverse_accumulatedTransform;
+                    auto matrix = vsg::translate(instance.translation) * vsg::rotate(instance.rotation) * vsg::scale(instance.scale);
+                    for (int corner = 0; corner < 8; ++corner)
+                    {
+                        vsg::dvec3 v((corner & 1) ? meshBounds.max.x : meshBounds.min.x,
+                                     (corner & 2) ? meshBounds.max.y : meshBounds.min.y,
+                                     (corner & 4) ? meshBounds.max.z : meshBounds.min.z);
+                        instancedMesh.bounds.add(matrix * v);
+                    }
                 }
+
+                // the mesh is now drawn by the InstanceNode so remove it from the original node.
+                model->nodes.values[instance.node]->mesh = glTFid{};
             }
-        }
-    }
 
-    for (auto& id : node.children.values)
-    {
-        auto child = model->nodes.values[id.value];
-        flattenTransforms(*child, accumulatedTransform);
+            // add a placeholder node to the scene that createSceneGraph() replaces with the vsg::InstanceNode.
+            auto gltf_node = gltf::Node::create();
+            gltf_node->name = model->meshes.values[mi]->name;
+
+            instancedMesh.node.value = static_cast<uint32_t>(model->nodes.values.size());
+            model->nodes.values.push_back(gltf_node);
+            model->scenes.values[sci]->nodes.values.push_back(instancedMesh.node);
+
+            vsg::debug("gltf::Builder::instanceSharedMeshes() mesh ", mi, " instanced ", count, " times.");
+
+            instancedMeshes.push_back(instancedMesh);
+        }
     }
 }
 
@@ -1671,10 +3570,62 @@ vsg::ref_ptr<vsg::Node> gltf::Builder::createScene(vsg::ref_ptr<gltf::Scene> glt
     }
 
     // All culling node if required.
-    bool culling = vsg::value<bool>(true, gltf::culling, options) && (instanceNodeHint == vsg::Options::INSTANCE_NONE);
-    if (culling)
+    bool sceneCulling = culling && (instanceNodeHint == vsg::Options::INSTANCE_NONE);
+    if (sceneCulling)
     {
-        if (auto bounds = vsg::visit<vsg::ComputeBounds>(children).bounds)
+        // compute the scene bounds from the POSITION accessors' min/max transformed by the node hierarchy rather than scanning the vertices.
+        vsg::dbox bounds;
+        std::vector<bool> visited(model->nodes.values.size(), false);
+        bool accessorBounds = true;
+        for (auto& id : gltf_scene->nodes.values)
+        {
+            if (!getNodeBounds(id.value, requiresRootTransformNode ? rootTransform : vsg::dmat4(), bounds, visited)) accessorBounds = false;
+        }
+
+        if (!accessorBounds)
+        {
+            // ComputeBounds ignores quantized vertex arrays so would under estimate the bounds, so only fallback to it when all positions are float.
+            bool floatPositions = true;
+            for (auto& gltf_mesh : model->meshes.values)
+            {
+                if (!gltf_mesh) continue;
+                for (auto& primitive : gltf_mesh->primitives.values)
+                {
+                    auto position_itr = primitive->attributes.values.find("POSITION");
+                    if (position_itr == primitive->attributes.values.end()) continue;
+
+                    auto componentType = model->accessors.values[position_itr->second.value]->componentType;
+                    if (componentType != COMPONENT_TYPE_FLOAT && componentType != COMPONENT_TYPE_DOUBLE) floatPositions = false;
+                }
+            }
+
+            if (floatPositions)
+                bounds = vsg::visit<vsg::ComputeBounds>(children).bounds;
+            else
+                sceneCulling = false;
+        }
+
+        // include the bounds of all the instances of automatically instanced meshes, computed by instanceSharedMeshes().
+        for (auto& instancedMesh : instancedMeshes)
+        {
+            if (!instancedMesh.bounds.valid()) continue;
+
+            bool inScene = false;
+            for (auto& id : gltf_scene->nodes.values)
+            {
+                if (id.value == instancedMesh.node.value) inScene = true;
+            }
+            if (!inScene) continue;
+
+            auto& ib = instancedMesh.bounds;
+            for (int corner = 0; corner < 8; ++corner)
+            {
+                vsg::dvec3 v((corner & 1) ? ib.max.x : ib.min.x, (corner & 2) ? ib.max.y : ib.min.y, (corner & 4) ? ib.max.z : ib.min.z);
+                bounds.add(requiresRootTransformNode ? rootTransform * v : v);
+            }
+        }
+
+        if (sceneCulling && bounds)
         {
             vsg::dsphere bs((bounds.max + bounds.min) * 0.5, vsg::length(bounds.max - bounds.min) * 0.5);
             if (children.size() == 1)
@@ -1710,20 +3661,70 @@ vsg::ref_ptr<vsg::Node> gltf::Builder::createScene(vsg::ref_ptr<gltf::Scene> glt
     // assign meta data
     assign_name_extras(*gltf_scene, *vsg_scene);
 
-    return vsg_scene;
+    return vsg_scene;
+}
+
+#ifdef vsgXchange_draco
+// holder for a decoded draco::Mesh, kept in Builder::decodedDracoMeshes when primitives are decoded concurrently.
+struct DecodedDracoMesh : public vsg::Inherit<vsg::Object, DecodedDracoMesh>
+{
+    std::shared_ptr<draco::Mesh> mesh;
+};
+
+static std::shared_ptr<draco::Mesh> DecodeDracoMesh(gltf::glTF& model, gltf::KHR_draco_mesh_compression& draco_mesh_compression)
+{
+    if (!draco_mesh_compression.bufferView || draco_mesh_compression.bufferView.value >= model.bufferViews.values.size()) return {};
+
+    auto& bufferView = model.bufferViews.values[draco_mesh_compression.bufferView.value];
+    auto& buffer = model.buffers.values[bufferView->buffer.value];
+    if (!buffer->data) return {};
+
+    auto bufferViewData = static_cast<const char*>(buffer->data->dataPointer()) + bufferView->byteOffset;
+    auto bufferViewSize = bufferView->byteLength;
+
+    draco::DecoderBuffer decodeBuffer;
+    decodeBuffer.Init(bufferViewData, bufferViewSize);
+
+    draco::Decoder decoder;
+    auto result = decoder.DecodeMeshFromBuffer(&decodeBuffer);
+    if (!result.ok())
+    {
+        vsg::warn("gltf::Builder draco decode failed : ", result.status().error_msg_string());
+        return {};
+    }
+
+    return std::shared_ptr<draco::Mesh>(std::move(result.value()));
 }
 
-#ifdef vsgXchange_draco
 template<typename T>
-static bool CopyDracoAttributes(const draco::PointAttribute* draco_attribute, void* ptr, draco::PointIndex::ValueType num_points)
+static bool CopyDracoAttributes(const draco::PointAttribute* draco_attribute, void* ptr, draco::PointIndex::ValueType num_points, uint32_t num_components, draco::DataType dataType)
 {
-    T* dest_ptr = reinterpret_cast<T*>(ptr);
+    size_t valueSize = sizeof(T) * num_components;
+
+    if (draco_attribute->data_type() == dataType && draco_attribute->num_components() == num_components)
+    {
+        // types match so copy the data directly, avoiding the per value conversion.
+        if (draco_attribute->is_mapping_identity() && draco_attribute->byte_stride() == static_cast<int64_t>(valueSize))
+        {
+            if (num_points > 0) std::memcpy(ptr, draco_attribute->GetAddress(draco::AttributeValueIndex(0)), valueSize * num_points);
+        }
+        else
+        {
+            uint8_t* dest_ptr = reinterpret_cast<uint8_t*>(ptr);
+            for (draco::PointIndex i(0); i < num_points; ++i)
+            {
+                std::memcpy(dest_ptr, draco_attribute->GetAddressOfMappedIndex(i), valueSize);
+                dest_ptr += valueSize;
+            }
+        }
+        return true;
+    }
 
-    auto num_components = draco_attribute->num_components();
+    T* dest_ptr = reinterpret_cast<T*>(ptr);
     for (draco::PointIndex i(0); i < num_points; ++i)
     {
         auto index = draco_attribute->mapped_index(i);
-        if (!draco_attribute->ConvertValue(index, num_components, dest_ptr)) return false;
+        if (!draco_attribute->ConvertValue(index, static_cast<int8_t>(num_components), dest_ptr)) return false;
 
         dest_ptr += num_components;
     }
@@ -1737,69 +3738,74 @@ bool gltf::Builder::decodePrimitiveIfRequired(vsg::ref_ptr<gltf::Primitive> prim
     if (auto draco_mesh_compression = primitive->extension<KHR_draco_mesh_compression>("KHR_draco_mesh_compression"))
     {
 #ifdef vsgXchange_draco
-        auto& bufferView = model->bufferViews.values[draco_mesh_compression->bufferView.value];
-        auto& buffer = model->buffers.values[bufferView->buffer.value];
-
-        auto bufferViewData = static_cast<const char*>(buffer->data->dataPointer()) + bufferView->byteOffset;
-        auto bufferViewSize = bufferView->byteLength;
-
-        draco::DecoderBuffer decodeBuffer;
-        decodeBuffer.Init(bufferViewData, bufferViewSize);
+        // use the mesh decoded by the concurrent pre-pass if available, otherwise decode it now.
+        // a pre-pass entry without a mesh is a decode that has already failed and reported its error, so isn't decoded again.
+        std::shared_ptr<draco::Mesh> mesh;
+        auto decoded_itr = decodedDracoMeshes.find(primitive.get());
+        if (decoded_itr != decodedDracoMeshes.end())
+        {
+            if (auto decoded = decoded_itr->second.cast<DecodedDracoMesh>()) mesh = decoded->mesh;
+            decodedDracoMeshes.erase(decoded_itr);
+        }
+        else
+        {
+            mesh = DecodeDracoMesh(*model, *draco_mesh_compression);
+        }
 
-        draco::Decoder decoder;
-        auto result = decoder.DecodeMeshFromBuffer(&decodeBuffer);
+        if (!mesh) return false;
 
-        auto& mesh = result.value();
         auto num_points = mesh->num_points();
 
-        // process indices
+        // process indices, writing them directly into the final index array
         if (primitive->indices)
         {
             auto& indices = model->accessors.values[primitive->indices.value];
 
-            // set the indices bufferView to the what will be the index value of bufferView to be created for the indices
-            indices->bufferView.value = static_cast<uint32_t>(model->bufferViews.values.size());
-
-            // hardwire to uint32_t for now
-            uint32_t componentSize = (num_points < 65536) ? 2 : 4;
-            uint32_t count = mesh->num_faces() * 3;
-
-            // set up BufferView for the indices
-            auto indexBufferView = gltf::BufferView::create();
-            indexBufferView->buffer.value = static_cast<uint32_t>(model->buffers.values.size());
-            indexBufferView->byteOffset = 0;
-            indexBufferView->byteLength = count * componentSize;
-            model->bufferViews.values.push_back(indexBufferView);
-
-            // set up Buffer for the indices
-            auto indexBuffer = gltf::Buffer::create();
-            indexBuffer->byteLength = indexBufferView->byteLength;
-            indexBuffer->data = vsg::ubyteArray::create(indexBuffer->byteLength);
-            model->buffers.values.push_back(indexBuffer);
+            uint32_t num_faces = mesh->num_faces();
+            uint32_t count = num_faces * 3;
 
-            if (componentSize == sizeof(draco::PointIndex))
+            if (num_points >= 65536 && sizeof(draco::PointIndex) == sizeof(uint32_t))
             {
+                // compatible size so can just copy data directly
+                auto uint_indices = vsg::uintArray::create(count);
+                if (count > 0) std::memcpy(uint_indices->dataPointer(), &(mesh->face(draco::FaceIndex(0)))[0], count * sizeof(uint32_t));
+
                 indices->componentType = COMPONENT_TYPE_UNSIGNED_INT;
-                indices->count = count;
+                indices->data = uint_indices;
+            }
+            else if (num_points >= 65536)
+            {
+                auto uint_indices = vsg::uintArray::create(count);
+                auto dest = uint_indices->data();
+                for (draco::FaceIndex i(0); i < num_faces; ++i)
+                {
+                    const auto& face = mesh->face(i);
+                    *(dest++) = face[0].value();
+                    *(dest++) = face[1].value();
+                    *(dest++) = face[2].value();
+                }
 
-                // compatible size so can just copy data directly
-                memcpy(indexBuffer->data->dataPointer(), &(mesh->face(draco::FaceIndex(0)))[0], indexBuffer->byteLength);
+                indices->componentType = COMPONENT_TYPE_UNSIGNED_INT;
+                indices->data = uint_indices;
             }
             else
             {
-                indices->componentType = COMPONENT_TYPE_UNSIGNED_SHORT;
-                indices->count = count;
-
                 // copy data across value by value converting to ushort type
-                uint16_t* dest = static_cast<uint16_t*>(indexBuffer->data->dataPointer());
-                for (draco::FaceIndex i(0); i < mesh->num_faces(); ++i)
+                auto ushort_indices = vsg::ushortArray::create(count);
+                auto dest = ushort_indices->data();
+                for (draco::FaceIndex i(0); i < num_faces; ++i)
                 {
                     const auto& face = mesh->face(i);
                     *(dest++) = static_cast<uint16_t>(face[0].value());
                     *(dest++) = static_cast<uint16_t>(face[1].value());
                     *(dest++) = static_cast<uint16_t>(face[2].value());
                 }
+
+                indices->componentType = COMPONENT_TYPE_UNSIGNED_SHORT;
+                indices->data = ushort_indices;
             }
+
+            indices->count = count;
         }
 
         auto& draco_attributes = draco_mesh_compression->attributes.values;
@@ -1812,61 +3818,58 @@ bool gltf::Builder::decodePrimitiveIfRequired(vsg::ref_ptr<gltf::Primitive> prim
                 auto& primitive_attribute = *itr;
 
                 const auto draco_attribute = mesh->GetAttributeByUniqueId(id.value);
-                auto& accessor = model->accessors.values[primitive_attribute.second.value];
+                if (!draco_attribute)
+                {
+                    vsg::warn("gltf::Builder::decodePrimitiveIfRequired() draco attribute ", name, " not found.");
+                    continue;
+                }
 
-                // update the attribute accessor to the decode entry
-                accessor->bufferView.value = static_cast<uint32_t>(model->bufferViews.values.size());
+                auto& accessor = model->accessors.values[primitive_attribute.second.value];
                 accessor->count = num_points;
 
-                auto dataProperties = accessor->getDataProperties();
-                uint32_t valueSize = dataProperties.componentSize * dataProperties.componentCount;
-
-                // allocate buffer and bufferView for decoded attribute
-                auto attributeBufferView = gltf::BufferView::create();
-                attributeBufferView->buffer.value = static_cast<uint32_t>(model->buffers.values.size());
-                attributeBufferView->byteLength = num_points * valueSize;
-                attributeBufferView->byteOffset = draco_attribute->byte_offset();
-                attributeBufferView->byteStride = draco_attribute->byte_stride();
-                model->bufferViews.values.push_back(attributeBufferView);
+                // allocate the final array and decode the attribute directly into it.
+                auto array = allocateArray(accessor->type, accessor->componentType, num_points);
+                if (!array) continue;
 
-                auto attributeBuffer = gltf::Buffer::create();
-                attributeBuffer->byteLength = attributeBufferView->byteLength;
-                attributeBuffer->data = vsg::ubyteArray::create(attributeBuffer->byteLength);
-                model->buffers.values.push_back(attributeBuffer);
-
-                auto* ptr = attributeBuffer->data->dataPointer();
+                auto dataProperties = accessor->getDataProperties();
+                auto* ptr = array->dataPointer();
+                bool result = false;
 
-                // TODO get the attributes from the draco mesh.
                 switch (accessor->componentType)
                 {
                 case (COMPONENT_TYPE_BYTE):
-                    CopyDracoAttributes<int8_t>(draco_attribute, ptr, num_points);
+                    result = CopyDracoAttributes<int8_t>(draco_attribute, ptr, num_points, dataProperties.componentCount, draco::DT_INT8);
                     break;
                 case (COMPONENT_TYPE_UNSIGNED_BYTE):
-                    CopyDracoAttributes<uint8_t>(draco_attribute, ptr, num_points);
+                    result = CopyDracoAttributes<uint8_t>(draco_attribute, ptr, num_points, dataProperties.componentCount, draco::DT_UINT8);
                     break;
                 case (COMPONENT_TYPE_SHORT):
-                    CopyDracoAttributes<int16_t>(draco_attribute, ptr, num_points);
+                    result = CopyDracoAttributes<int16_t>(draco_attribute, ptr, num_points, dataProperties.componentCount, draco::DT_INT16);
                     break;
                 case (COMPONENT_TYPE_UNSIGNED_SHORT):
-                    CopyDracoAttributes<uint16_t>(draco_attribute, ptr, num_points);
+                    result = CopyDracoAttributes<uint16_t>(draco_attribute, ptr, num_points, dataProperties.componentCount, draco::DT_UINT16);
                     break;
                 case (COMPONENT_TYPE_INT):
-                    CopyDracoAttributes<int32_t>(draco_attribute, ptr, num_points);
+                    result = CopyDracoAttributes<int32_t>(draco_attribute, ptr, num_points, dataProperties.componentCount, draco::DT_INT32);
                     break;
                 case (COMPONENT_TYPE_UNSIGNED_INT):
-                    CopyDracoAttributes<uint32_t>(draco_attribute, ptr, num_points);
+                    result = CopyDracoAttributes<uint32_t>(draco_attribute, ptr, num_points, dataProperties.componentCount, draco::DT_UINT32);
                     break;
                 case (COMPONENT_TYPE_FLOAT):
-                    CopyDracoAttributes<float>(draco_attribute, ptr, num_points);
+                    result = CopyDracoAttributes<float>(draco_attribute, ptr, num_points, dataProperties.componentCount, draco::DT_FLOAT32);
                     break;
                 case (COMPONENT_TYPE_DOUBLE):
-                    CopyDracoAttributes<double>(draco_attribute, ptr, num_points);
+                    result = CopyDracoAttributes<double>(draco_attribute, ptr, num_points, dataProperties.componentCount, draco::DT_FLOAT64);
                     break;
                 default:
                     vsg::info("unsupported type ", dataProperties.componentType);
                     break;
                 }
+
+                if (result)
+                    accessor->data = array;
+                else
+                    vsg::warn("gltf::Builder::decodePrimitiveIfRequired() unable to convert draco attribute ", name);
             }
         }
 
@@ -1879,6 +3882,79 @@ bool gltf::Builder::decodePrimitiveIfRequired(vsg::ref_ptr<gltf::Primitive> prim
     return true;
 }
 
+bool gltf::Builder::decodeBufferViewIfRequired(vsg::ref_ptr<gltf::BufferView> bufferView)
+{
+    auto meshopt_compression = bufferView->extension<EXT_meshopt_compression>("EXT_meshopt_compression");
+    if (!meshopt_compression) return true;
+
+#ifdef vsgXchange_meshopt
+    if (!meshopt_compression->buffer || meshopt_compression->buffer.value >= model->buffers.values.size())
+    {
+        vsg::warn("gltf::Builder::decodeBufferViewIfRequired() EXT_meshopt_compression buffer ", meshopt_compression->buffer, " invalid.");
+        return false;
+    }
+
+    auto& compressedBuffer = model->buffers.values[meshopt_compression->buffer.value];
+    if (!compressedBuffer->data || compressedBuffer->data->dataSize() < static_cast<size_t>(meshopt_compression->byteOffset) + meshopt_compression->byteLength)
+    {
+        vsg::warn("gltf::Builder::decodeBufferViewIfRequired() EXT_meshopt_compression buffer data not available.");
+        return false;
+    }
+
+    auto src = static_cast<const unsigned char*>(compressedBuffer->data->dataPointer()) + meshopt_compression->byteOffset;
+    size_t srcSize = meshopt_compression->byteLength;
+
+    size_t count = meshopt_compression->count;
+    size_t stride = meshopt_compression->byteStride;
+    auto decodedData = vsg::ubyteArray::create(static_cast<uint32_t>(count * stride));
+    auto dest = decodedData->dataPointer();
+
+    int result = -1;
+    if (meshopt_compression->mode == "ATTRIBUTES")
+        result = meshopt_decodeVertexBuffer(dest, count, stride, src, srcSize);
+    else if (meshopt_compression->mode == "TRIANGLES")
+        result = meshopt_decodeIndexBuffer(dest, count, stride, src, srcSize);
+    else if (meshopt_compression->mode == "INDICES")
+        result = meshopt_decodeIndexSequence(dest, count, stride, src, srcSize);
+    else
+        vsg::warn("gltf::Builder::decodeBufferViewIfRequired() EXT_meshopt_compression mode ", meshopt_compression->mode, " not supported.");
+
+    if (result != 0)
+    {
+        vsg::warn("gltf::Builder::decodeBufferViewIfRequired() EXT_meshopt_compression decode failed, mode = ", meshopt_compression->mode, ", result = ", result);
+        return false;
+    }
+
+    if (meshopt_compression->filter == "OCTAHEDRAL")
+        meshopt_decodeFilterOct(dest, count, stride);
+    else if (meshopt_compression->filter == "QUATERNION")
+        meshopt_decodeFilterQuat(dest, count, stride);
+    else if (meshopt_compression->filter == "EXPONENTIAL")
+        meshopt_decodeFilterExp(dest, count, stride);
+    else if (meshopt_compression->filter != "NONE")
+        vsg::warn("gltf::Builder::decodeBufferViewIfRequired() EXT_meshopt_compression filter ", meshopt_compression->filter, " not supported.");
+
+    // place the decoded data in its own Buffer and point the BufferView at it, leaving any fallback buffer unused.
+    auto decodedBuffer = gltf::Buffer::create();
+    decodedBuffer->byteLength = static_cast<uint32_t>(decodedData->dataSize());
+    decodedBuffer->data = decodedData;
+
+    bufferView->buffer.value = static_cast<uint32_t>(model->buffers.values.size());
+    bufferView->byteOffset = 0;
+    bufferView->byteLength = decodedBuffer->byteLength;
+
+    model->buffers.values.push_back(decodedBuffer);
+
+    return true;
+#else
+    // the uncompressed fallback buffer can be used if it has been loaded.
+    if (bufferView->buffer && model->buffers.values[bufferView->buffer.value]->data) return true;
+
+    vsg::info("BufferView meshopt_compression = ", meshopt_compression, " not supported.");
+    return false;
+#endif
+}
+
 vsg::ref_ptr<vsg::ShaderSet> gltf::Builder::getOrCreatePbrShaderSet()
 {
     if (pbrShaderSet) return pbrShaderSet;
@@ -1899,11 +3975,64 @@ vsg::ref_ptr<vsg::ShaderSet> gltf::Builder::getOrCreateFlatShaderSet()
     return flatShaderSet;
 }
 
+void gltf::Builder::runInParallel(size_t count, const std::function<void(size_t)>& func, bool parallel)
+{
+    auto operationThreads = (parallel && options) ? options->operationThreads : vsg::ref_ptr<vsg::OperationThreads>();
+    if (!operationThreads || operationThreads->threads.empty() || count < 2)
+    {
+        for (size_t i = 0; i < count; ++i) func(i);
+        return;
+    }
+
+    struct RangeOperation : public vsg::Inherit<vsg::Operation, RangeOperation>
+    {
+        const std::function<void(size_t)>& func;
+        size_t start;
+        size_t end;
+        vsg::ref_ptr<vsg::Latch> latch;
+
+        RangeOperation(const std::function<void(size_t)>& f, size_t s, size_t e, vsg::ref_ptr<vsg::Latch> l) :
+            func(f),
+            start(s),
+            end(e),
+            latch(l) {}
+
+        void run() override
+        {
+            for (size_t i = start; i < end; ++i) func(i);
+            latch->count_down();
+        }
+    };
+
+    // split into several ranges per thread so that uneven workloads still balance out, results are written by index so remain deterministic.
+    size_t numRanges = std::min(count, (operationThreads->threads.size() + 1) * 4);
+    size_t rangeSize = (count + numRanges - 1) / numRanges;
+    numRanges = (count + rangeSize - 1) / rangeSize;
+
+    auto latch = vsg::Latch::create(static_cast<int>(numRanges));
+    std::vector<vsg::ref_ptr<vsg::Operation>> operations;
+    for (size_t start = 0; start < count; start += rangeSize)
+    {
+        operations.push_back(RangeOperation::create(func, start, std::min(start + rangeSize, count), latch));
+    }
+
+    operationThreads->add(operations.begin(), operations.end(), vsg::INSERT_FRONT);
+
+    // use this thread to process operations as well
+    operationThreads->run();
+
+    latch->wait();
+}
+
 vsg::ref_ptr<vsg::Object> gltf::Builder::createSceneGraph(vsg::ref_ptr<gltf::glTF> in_model, vsg::ref_ptr<const vsg::Options> in_options)
 {
     model = in_model;
     if (!model) return {};
 
+    // reset the state built for a previous model when the Builder is reused.
+    instancedMeshes.clear();
+    vsg_packedJoints.clear();
+
     if (in_options) options = in_options;
 
     if (options) sharedObjects = options->sharedObjects;
@@ -1911,6 +4040,22 @@ vsg::ref_ptr<vsg::Object> gltf::Builder::createSceneGraph(vsg::ref_ptr<gltf::glT
 
     instanceNodeHint = options ? options->instanceNodeHint : vsg::Options::INSTANCE_NONE;
     cloneAccessors = vsg::value<bool>(cloneAccessors, gltf::clone_accessors, options);
+    compactBuffers = vsg::value<bool>(compactBuffers, gltf::compact_buffers, options);
+    compressVertices = vsg::value<bool>(compressVertices, gltf::compress_vertices, options);
+    clusterSize = vsg::value<uint32_t>(clusterSize, gltf::cluster_size, options);
+    parallelBuild = vsg::value<bool>(parallelBuild, gltf::parallel_build, options);
+    quantizedAttributes = vsg::value<bool>(quantizedAttributes, gltf::quantized_attributes, options);
+    optimizeIndices = vsg::value<bool>(optimizeIndices, gltf::optimize_indices, options);
+    flattenStaticTransforms = vsg::value<bool>(flattenStaticTransforms, gltf::flatten_static_transforms, options);
+    instanceThreshold = vsg::value<uint32_t>(instanceThreshold, gltf::instance_threshold, options);
+    interleavedVertices = vsg::value<bool>(interleavedVertices, gltf::interleaved_vertices, options);
+    packedJoints = vsg::value<bool>(packedJoints, gltf::packed_joints, options);
+    animationSampleRate = vsg::value<float>(animationSampleRate, gltf::animation_sample_rate, options);
+    animationTolerance = vsg::value<float>(animationTolerance, gltf::animation_tolerance, options);
+    mergeGeometry = vsg::value<bool>(mergeGeometry, gltf::merge_geometry, options);
+    shareAccessors = vsg::value<bool>(shareAccessors, gltf::share_accessors, options);
+    shareImages = vsg::value<bool>(shareImages, gltf::share_images, options);
+    culling = vsg::value<bool>(culling, gltf::culling, options);
     maxAnisotropy = vsg::value<float>(maxAnisotropy, gltf::maxAnisotropy, options);
 
     // TODO: need to check that the glTF model is suitable for use of InstanceNode/InstanceDraw
@@ -1938,35 +4083,97 @@ vsg::ref_ptr<vsg::Object> gltf::Builder::createSceneGraph(vsg::ref_ptr<gltf::glT
         default_material->assignDescriptor("material", pbrMaterialValue);
     }
 
+    for (size_t bvi = 0; bvi < model->bufferViews.values.size(); ++bvi)
+    {
+        // entries released by glTF::prune() are null
+        if (!model->bufferViews.values[bvi]) continue;
+
+        if (!decodeBufferViewIfRequired(model->bufferViews.values[bvi]))
+        {
+#ifdef vsgXchange_meshopt
+            vsg::warn("gltf::Builder EXT_meshopt_compression decode failed for bufferView ", bvi, ".");
+#else
+            vsg::info("Requires meshopt decompression but no support compiled in.");
+#endif
+            return {};
+        }
+    }
+
+#ifdef vsgXchange_draco
+    {
+        // decode all the draco compressed primitives concurrently, runInParallel waits for all decodes to complete before the
+        // decoded data is added to the model below.
+        std::vector<std::pair<const gltf::Primitive*, vsg::ref_ptr<KHR_draco_mesh_compression>>> compressedPrimitives;
+        for (auto& mesh : model->meshes.values)
+        {
+            if (!mesh) continue;
+            for (auto& primitive : mesh->primitives.values)
+            {
+                if (auto draco_mesh_compression = primitive->extension<KHR_draco_mesh_compression>("KHR_draco_mesh_compression"))
+                {
+                    compressedPrimitives.emplace_back(primitive.get(), draco_mesh_compression);
+                }
+            }
+        }
+
+        // record every attempted decode, including failures with a null mesh, so failed primitives aren't decoded a second time.
+        std::vector<vsg::ref_ptr<DecodedDracoMesh>> decodedMeshes(compressedPrimitives.size());
+        runInParallel(compressedPrimitives.size(), [&](size_t i) {
+            auto decoded = DecodedDracoMesh::create();
+            decoded->mesh = DecodeDracoMesh(*model, *compressedPrimitives[i].second);
+            decodedMeshes[i] = decoded;
+        }, true);
+
+        decodedDracoMeshes.clear();
+        for (size_t i = 0; i < compressedPrimitives.size(); ++i)
+        {
+            decodedDracoMeshes[compressedPrimitives[i].first] = decodedMeshes[i];
+        }
+    }
+#endif
+
     for (size_t mi = 0; mi < model->meshes.values.size(); ++mi)
     {
         auto mesh = model->meshes.values[mi];
+        if (!mesh) continue;
         for (auto primitive : mesh->primitives.values)
         {
             if (!decodePrimitiveIfRequired(primitive))
             {
-                vsg::info("Reqires draco decompression but no support available.");
+                decodedDracoMeshes.clear();
+#ifdef vsgXchange_draco
+                vsg::warn("gltf::Builder KHR_draco_mesh_compression decode failed for mesh ", mi, ".");
+#else
+                vsg::info("Requires draco decompression but no support compiled in.");
+#endif
                 return {};
             }
         }
     }
+    decodedDracoMeshes.clear();
 
     vsg_buffers.resize(model->buffers.values.size());
     for (size_t bi = 0; bi < model->buffers.values.size(); ++bi)
     {
-        vsg_buffers[bi] = createBuffer(model->buffers.values[bi]);
+        if (model->buffers.values[bi]) vsg_buffers[bi] = createBuffer(model->buffers.values[bi]);
     }
 
     vsg_bufferViews.resize(model->bufferViews.values.size());
     for (size_t bvi = 0; bvi < model->bufferViews.values.size(); ++bvi)
     {
-        vsg_bufferViews[bvi] = createBufferView(model->bufferViews.values[bvi]);
+        if (model->bufferViews.values[bvi]) vsg_bufferViews[bvi] = createBufferView(model->bufferViews.values[bvi]);
     }
 
     vsg_accessors.resize(model->accessors.values.size());
+    runInParallel(model->accessors.values.size(), [&](size_t ai) {
+        // sparse accessors write into the buffers they reference so are created serially below.
+        auto& gltf_accessor = model->accessors.values[ai];
+        if (gltf_accessor && !gltf_accessor->sparse) vsg_accessors[ai] = createAccessor(gltf_accessor);
+    }, parallelBuild);
     for (size_t ai = 0; ai < model->accessors.values.size(); ++ai)
     {
-        vsg_accessors[ai] = createAccessor(model->accessors.values[ai]);
+        auto& gltf_accessor = model->accessors.values[ai];
+        if (gltf_accessor && gltf_accessor->sparse) vsg_accessors[ai] = createAccessor(gltf_accessor);
     }
 
     if (instanceNodeHint != vsg::Options::INSTANCE_NONE)
@@ -1983,6 +4190,37 @@ vsg::ref_ptr<vsg::Object> gltf::Builder::createSceneGraph(vsg::ref_ptr<gltf::glT
             }
         }
     }
+    else if (flattenStaticTransforms)
+    {
+        bakeStaticTransforms();
+    }
+
+    if (compactBuffers)
+    {
+        // done before shareAccessors so the DataCache holds the compacted arrays rather than views that keep the buffers resident.
+        compactAccessors();
+    }
+
+    if (shareAccessors)
+    {
+        // replace accessor data with any byte identical data already loaded with the same sharedObjects,
+        // done after flattenTransforms() as it modifies the vertex arrays in place.
+        auto dataCache = sharedObjects->shareDefault<DataCache>();
+        runInParallel(vsg_accessors.size(), [&](size_t ai) {
+            if (vsg_accessors[ai]) vsg_accessors[ai] = dataCache->share(vsg_accessors[ai]);
+        }, parallelBuild);
+    }
+
+    if (instanceThreshold > 0 && instanceNodeHint == vsg::Options::INSTANCE_NONE)
+    {
+        // done before mergeStaticGeometry() so widely shared meshes are instanced rather than duplicated into the merged batches.
+        instanceSharedMeshes();
+    }
+
+    if (mergeGeometry && instanceNodeHint == vsg::Options::INSTANCE_NONE)
+    {
+        mergeStaticGeometry();
+    }
 
     // vsg::info("create cameras = ", model->cameras.values.size());
     vsg_cameras.resize(model->cameras.values.size());
@@ -1996,6 +4234,7 @@ vsg::ref_ptr<vsg::Object> gltf::Builder::createSceneGraph(vsg::ref_ptr<gltf::glT
     for (size_t si = 0; si < model->skins.values.size(); ++si)
     {
         auto& gltf_skin = model->skins.values[si];
+        if (!gltf_skin) continue;
         for (auto joint : gltf_skin->joints.values)
         {
             vsg_joints[joint.value] = true;
@@ -2017,11 +4256,18 @@ vsg::ref_ptr<vsg::Object> gltf::Builder::createSceneGraph(vsg::ref_ptr<gltf::glT
         if (model->images.values[ii]) vsg_images[ii] = createImage(model->images.values[ii]);
     }
 
+    if (compactBuffers)
+    {
+        releaseBuffers();
+    }
+
     // vsg::info("create textures = ", model->textures.values.size());
     vsg_textures.resize(model->textures.values.size());
     for (size_t ti = 0; ti < model->textures.values.size(); ++ti)
     {
         auto& gltf_texture = model->textures.values[ti];
+        if (!gltf_texture) continue;
+
         auto& si = vsg_textures[ti] = createTexture(gltf_texture);
 
         if (si.sampler && si.image)
@@ -2044,10 +4290,27 @@ vsg::ref_ptr<vsg::Object> gltf::Builder::createSceneGraph(vsg::ref_ptr<gltf::glT
     }
 
     // vsg::info("create materials = ", model->materials.values.size());
+    if (parallelBuild)
+    {
+        // make sure the ShaderSets are created up front rather than lazily from multiple threads.
+        for (auto& gltf_material : model->materials.values)
+        {
+            if (gltf_material && gltf_material->extension<KHR_materials_unlit>("KHR_materials_unlit"))
+            {
+                getOrCreateFlatShaderSet();
+                break;
+            }
+        }
+    }
+
     vsg_materials.resize(model->materials.values.size());
-    for (size_t mi = 0; mi < model->materials.values.size(); ++mi)
+    runInParallel(model->materials.values.size(), [&](size_t mi) {
+        if (model->materials.values[mi]) vsg_materials[mi] = createMaterial(model->materials.values[mi]);
+    }, parallelBuild);
+
+    if (compressVertices)
     {
-        vsg_materials[mi] = createMaterial(model->materials.values[mi]);
+        compressAccessors();
     }
 
     // vsg::info("create meshes = ", model->meshes.values.size());
@@ -2068,6 +4331,7 @@ vsg::ref_ptr<vsg::Object> gltf::Builder::createSceneGraph(vsg::ref_ptr<gltf::glT
     for (size_t si = 0; si < model->skins.values.size(); ++si)
     {
         auto& gltf_skin = model->skins.values[si];
+        if (!gltf_skin) continue;
 
         auto jointSampler = vsg::JointSampler::create();
         jointSampler->jointMatrices = vsg::mat4Array::create(gltf_skin->joints.values.size());
@@ -2097,18 +4361,70 @@ vsg::ref_ptr<vsg::Object> gltf::Builder::createSceneGraph(vsg::ref_ptr<gltf::glT
         assign_name_extras(*gltf_skin, *jointSampler);
     }
 
+    if (parallelBuild)
+    {
+        // meshes are created by the first node that references them, so collect the MeshExtras that node would use.
+        // Skinned meshes assign the jointMatrices to their materials so are left for createNode to build serially.
+        std::vector<MeshExtras> meshExtras(model->meshes.values.size());
+        std::vector<bool> buildMesh(model->meshes.values.size(), false);
+        std::vector<bool> meshAssigned(model->meshes.values.size(), false);
+        for (auto& gltf_node : model->nodes.values)
+        {
+            if (!gltf_node || !gltf_node->mesh || meshAssigned[gltf_node->mesh.value]) continue;
+
+            meshAssigned[gltf_node->mesh.value] = true;
+            if (gltf_node->skin) continue;
+
+            if (auto mesh_gpu_instancing = gltf_node->extension<EXT_mesh_gpu_instancing>("EXT_mesh_gpu_instancing"))
+            {
+                meshExtras[gltf_node->mesh.value].instancedAttributes = mesh_gpu_instancing->attributes;
+            }
+            buildMesh[gltf_node->mesh.value] = true;
+        }
+
+        runInParallel(model->meshes.values.size(), [&](size_t mi) {
+            if (buildMesh[mi]) vsg_meshes[mi] = createMesh(model->meshes.values[mi], meshExtras[mi]);
+        }, parallelBuild);
+    }
+
     // vsg::info("create nodes = ", model->nodes.values.size());
     vsg_nodes.resize(model->nodes.values.size());
     for (size_t ni = 0; ni < model->nodes.values.size(); ++ni)
     {
-        vsg_nodes[ni] = createNode(model->nodes.values[ni], vsg_joints[ni]);
+        if (model->nodes.values[ni]) vsg_nodes[ni] = createNode(model->nodes.values[ni], vsg_joints[ni]);
+    }
+
+    for (auto& instancedMesh : instancedMeshes)
+    {
+        MeshExtras meshExtras;
+        meshExtras.instanceNode = true;
+
+        auto instanceNode = vsg::InstanceNode::create();
+        instanceNode->firstInstance = 0;
+        instanceNode->instanceCount = static_cast<uint32_t>(instancedMesh.translations->size());
+        instanceNode->setTranslations(instancedMesh.translations);
+        instanceNode->setRotations(instancedMesh.rotations);
+        instanceNode->setScales(instancedMesh.scales);
+        instanceNode->child = createMesh(model->meshes.values[instancedMesh.mesh.value], meshExtras);
+        if (!instanceNode->child) continue;
+
+        auto& bounds = instancedMesh.bounds;
+        if (bounds.valid() && culling)
+        {
+            vsg::dsphere bs((bounds.max + bounds.min) * 0.5, vsg::length(bounds.max - bounds.min) * 0.5);
+            vsg_nodes[instancedMesh.node.value] = vsg::CullNode::create(bs, instanceNode);
+        }
+        else
+        {
+            vsg_nodes[instancedMesh.node.value] = instanceNode;
+        }
     }
 
     for (size_t ni = 0; ni < model->nodes.values.size(); ++ni)
     {
         auto& gltf_node = model->nodes.values[ni];
 
-        if (!gltf_node->children.values.empty())
+        if (gltf_node && !gltf_node->children.values.empty())
         {
 
             if (auto vsg_group = vsg_nodes[ni].cast<vsg::Group>())
@@ -2138,6 +4454,7 @@ vsg::ref_ptr<vsg::Object> gltf::Builder::createSceneGraph(vsg::ref_ptr<gltf::glT
     for (size_t si = 0; si < model->skins.values.size(); ++si)
     {
         auto& gltf_skin = model->skins.values[si];
+        if (!gltf_skin) continue;
 
         for (size_t i = 0; i < gltf_skin->joints.values.size(); ++i)
         {
@@ -2166,7 +4483,7 @@ vsg::ref_ptr<vsg::Object> gltf::Builder::createSceneGraph(vsg::ref_ptr<gltf::glT
         // for now just add JointSampler to all animations, do need to check that animation is associted with samplers joints.
         for (auto& jointSampler : vsg_skins)
         {
-            vsg_animations[ai]->samplers.push_back(jointSampler);
+            if (jointSampler) vsg_animations[ai]->samplers.push_back(jointSampler);
         }
     }
 
@@ -2206,3 +4523,185 @@ vsg::ref_ptr<vsg::Object> gltf::Builder::createSceneGraph(vsg::ref_ptr<gltf::glT
         return {};
     }
 }
+
+vsg::ref_ptr<gltf::Summary> gltf::Builder::createSummary(vsg::ref_ptr<gltf::glTF> in_model, vsg::ref_ptr<const vsg::Options> in_options)
+{
+    model = in_model;
+    if (!model) return {};
+
+    if (in_options) options = in_options;
+
+    auto summary = gltf::Summary::create();
+    summary->nodeCount = static_cast<uint32_t>(model->nodes.values.size());
+    summary->meshCount = static_cast<uint32_t>(model->meshes.values.size());
+
+    for (auto& buffer : model->buffers.values)
+    {
+        summary->bufferBytes += buffer->byteLength;
+    }
+
+    vsg::CoordinateConvention destination_coordinateConvention = vsg::CoordinateConvention::Z_UP;
+    if (options) destination_coordinateConvention = options->sceneCoordinateConvention;
+
+    vsg::dmat4 rootTransform;
+    vsg::transform(source_coordinateConvention, destination_coordinateConvention, rootTransform);
+
+    auto accessorCount = [&](glTFid id) -> uint64_t {
+        return (id && id.value < model->accessors.values.size()) ? model->accessors.values[id.value]->count : 0;
+    };
+
+    std::function<void(glTFid, const vsg::dmat4&)> accumulate = [&](glTFid id, const vsg::dmat4& inheritedTransform) {
+        if (!id || id.value >= model->nodes.values.size()) return;
+
+        auto& gltf_node = model->nodes.values[id.value];
+
+        vsg::dmat4 accumulatedTransform = inheritedTransform;
+        vsg::dmat4 localMatrix;
+        if (getTransform(*gltf_node, localMatrix)) accumulatedTransform = accumulatedTransform * localMatrix;
+
+        if (gltf_node->mesh && gltf_node->mesh.value < model->meshes.values.size())
+        {
+            // bounds don't include the EXT_mesh_gpu_instancing translations as they are only available in the buffers.
+            uint64_t instances = 1;
+            if (auto mesh_gpu_instancing = gltf_node->extension<EXT_mesh_gpu_instancing>("EXT_mesh_gpu_instancing"); mesh_gpu_instancing && mesh_gpu_instancing->attributes && !mesh_gpu_instancing->attributes->values.empty())
+            {
+                instances = accessorCount(mesh_gpu_instancing->attributes->values.begin()->second);
+            }
+
+            for (auto& primitive : model->meshes.values[gltf_node->mesh.value]->primitives.values)
+            {
+                uint64_t vertexCount = 0;
+                if (auto position_itr = primitive->attributes.values.find("POSITION"); position_itr != primitive->attributes.values.end())
+                {
+                    vertexCount = accessorCount(position_itr->second);
+
+                    vsg::dbox bounds;
+                    if (position_itr->second.value < model->accessors.values.size() && getBounds(*model->accessors.values[position_itr->second.value], bounds))
+                    {
+                        summary->addBounds(bounds, rootTransform * accumulatedTransform);
+                    }
+                }
+
+                uint64_t indexCount = primitive->indices ? accessorCount(primitive->indices) : vertexCount;
+                uint64_t triangleCount = 0;
+                switch (primitive->mode)
+                {
+                case (4): triangleCount = indexCount / 3; break;
+                case (5):
+                case (6): triangleCount = (indexCount >= 3) ? (indexCount - 2) : 0; break;
+                default: break;
+                }
+
+                summary->primitiveCount += instances;
+                summary->vertexCount += vertexCount * instances;
+                summary->triangleCount += triangleCount * instances;
+            }
+        }
+
+        for (auto& child : gltf_node->children.values)
+        {
+            accumulate(child, accumulatedTransform);
+        }
+    };
+
+    // match createSceneGraph(), which shows the default scene when there are several.
+    if (model->scene && model->scene.value < model->scenes.values.size())
+    {
+        for (auto& id : model->scenes.values[model->scene.value]->nodes.values) accumulate(id, vsg::dmat4());
+    }
+    else
+    {
+        for (auto& gltf_scene : model->scenes.values)
+        {
+            for (auto& id : gltf_scene->nodes.values) accumulate(id, vsg::dmat4());
+        }
+    }
+
+    // only read enough of each image to get its dimensions from its header.
+    const size_t headerSize = 65536;
+    std::vector<uint8_t> header;
+
+    auto readFileHeader = [&](const std::string_view& uri, size_t offset, size_t size) -> bool {
+        auto filename = vsg::findFile(decodeURI(uri), options);
+        if (!filename) return false;
+
+        std::ifstream fin(filename, std::ios::in | std::ios::binary);
+        fin.seekg(offset);
+        header.resize(std::min(size, headerSize));
+        fin.read(reinterpret_cast<char*>(header.data()), header.size());
+        header.resize(static_cast<size_t>(fin.gcount()));
+        return !header.empty();
+    };
+
+    auto decodeHeader = [&](const std::string_view& encoded, size_t offset, size_t size) -> bool {
+        // base64 encodes each 3 bytes as 4 characters so start decoding from the group containing offset.
+        size_t skip = offset % 3;
+        size_t start = (offset / 3) * 4;
+        if (start >= encoded.size()) return false;
+
+        header.resize(std::min(size, headerSize) + skip);
+        decodeBase64(encoded.substr(start), header.data(), header.size());
+        header.erase(header.begin(), header.begin() + skip);
+        return true;
+    };
+
+    for (auto& image : model->images.values)
+    {
+        auto& imageSummary = summary->images.emplace_back();
+
+        std::string_view mimeType;
+        std::string_view encoding;
+        std::string_view value;
+
+        bool headerRead = false;
+        if (!image->uri.empty())
+        {
+            if (dataURI(image->uri, mimeType, encoding, value))
+            {
+                imageSummary.uri = mimeType;
+                headerRead = decodeHeader(value, 0, headerSize);
+            }
+            else
+            {
+                imageSummary.uri = image->uri;
+                headerRead = readFileHeader(image->uri, 0, headerSize);
+            }
+        }
+        else if (image->bufferView && image->bufferView.value < model->bufferViews.values.size())
+        {
+            imageSummary.uri = image->mimeType;
+
+            auto& bufferView = model->bufferViews.values[image->bufferView.value];
+            if (bufferView->buffer && bufferView->buffer.value < model->buffers.values.size())
+            {
+                auto& buffer = model->buffers.values[bufferView->buffer.value];
+                if (buffer->data)
+                {
+                    // .glb binary chunk
+                    auto dataSize = buffer->data->dataSize();
+                    if (bufferView->byteOffset < dataSize)
+                    {
+                        auto ptr = static_cast<const uint8_t*>(buffer->data->dataPointer()) + bufferView->byteOffset;
+                        header.assign(ptr, ptr + std::min({static_cast<size_t>(bufferView->byteLength), dataSize - bufferView->byteOffset, headerSize}));
+                        headerRead = true;
+                    }
+                }
+                else if (dataURI(buffer->uri, mimeType, encoding, value))
+                {
+                    headerRead = decodeHeader(value, bufferView->byteOffset, bufferView->byteLength);
+                }
+                else if (!buffer->uri.empty())
+                {
+                    headerRead = readFileHeader(buffer->uri, bufferView->byteOffset, bufferView->byteLength);
+                }
+            }
+        }
+
+        if (!headerRead || !imageDimensions(header.data(), header.size(), imageSummary.width, imageSummary.height))
+        {
+            vsg::debug("gltf::Builder::createSummary() unable to read dimensions of image ", imageSummary.uri);
+        }
+    }
+
+    return summary;
+}
@@ -0,0 +1,309 @@
+/* <editor-fold desc="MIT License">
+
+Copyright(c) 2025 Robert Osfield
+
+Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated documentation files (the "Software"), to deal in the Software without restriction, including without limitation the rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to permit persons to whom the Software is furnished to do so, subject to the following conditions:
+
+The above copyright notice and this permission notice shall be included in all copies or substantial portions of the Software.
+
+THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+
+</editor-fold> */
+
+#include <vsgXchange/gltf.h>
+
+#include <vsg/threading/Latch.h>
+#include <vsg/threading/OperationThreads.h>
+
+#include <algorithm>
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#    define VSGXCHANGE_BASE64_X86
+#    include <immintrin.h>
+#    if defined(_MSC_VER)
+#        include <intrin.h>
+#        define VSGXCHANGE_TARGET(T)
+#    else
+#        define VSGXCHANGE_TARGET(T) __attribute__((target(T)))
+#    endif
+#endif
+
+using namespace vsgXchange;
+
+namespace
+{
+    struct Base64Lookup
+    {
+        uint8_t values[256];
+
+        Base64Lookup()
+        {
+            // invalid characters map to 0 to match the behaviour of the original decoder
+            for (uint32_t c = 0; c < 256; ++c)
+            {
+                if (c >= 'A' && c <= 'Z')
+                    values[c] = static_cast<uint8_t>(c - 'A');
+                else if (c >= 'a' && c <= 'z')
+                    values[c] = static_cast<uint8_t>(c - 'a' + 26);
+                else if (c >= '0' && c <= '9')
+                    values[c] = static_cast<uint8_t>(c - '0' + 52);
+                else if (c == '+')
+                    values[c] = 62;
+                else if (c == '/')
+                    values[c] = 63;
+                else
+                    values[c] = 0;
+            }
+        }
+    };
+
+    const Base64Lookup s_lookup;
+
+    /// decode numQuads groups of 4 characters into numQuads groups of 3 bytes.
+    void decode_scalar(const char* src, size_t numQuads, uint8_t* dest)
+    {
+        const uint8_t* lookup = s_lookup.values;
+        for (; numQuads > 0; --numQuads)
+        {
+            const uint8_t decodedBytes[4] = {lookup[static_cast<uint8_t>(src[0])], lookup[static_cast<uint8_t>(src[1])], lookup[static_cast<uint8_t>(src[2])], lookup[static_cast<uint8_t>(src[3])]};
+
+            dest[0] = static_cast<uint8_t>((decodedBytes[0] << 2) + ((decodedBytes[1] & 0x30) >> 4));
+            dest[1] = static_cast<uint8_t>(((decodedBytes[1] & 0x0f) << 4) + ((decodedBytes[2] & 0x3c) >> 2));
+            dest[2] = static_cast<uint8_t>(((decodedBytes[2] & 0x03) << 6) + decodedBytes[3]);
+
+            src += 4;
+            dest += 3;
+        }
+    }
+
+#if defined(VSGXCHANGE_BASE64_X86)
+
+    // SIMD decoding follows the pshufb range lookup approach of Wojciech Muła and Daniel Lemire,
+    // "Faster Base64 Encoding and Decoding Using AVX2 Instructions", ACM Transactions on the Web, 2018.
+    // Blocks containing characters outside of the base64 alphabet are handed to decode_scalar so the results match it exactly.
+
+    VSGXCHANGE_TARGET("sse4.1")
+    void decode_sse41(const char* src, size_t numQuads, uint8_t* dest)
+    {
+        const __m128i lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+        const __m128i lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+        const __m128i lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m128i mask_2F = _mm_set1_epi8(0x2f);
+        const __m128i merge_ab_and_bc = _mm_set1_epi32(0x01400140);
+        const __m128i merge_abc = _mm_set1_epi32(0x00011000);
+        const __m128i pack = _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+
+        // each iteration reads 16 characters and writes 16 bytes of which 12 are valid, so stop while the 4 byte overrun is still within dest
+        while (numQuads >= 6)
+        {
+            __m128i str = _mm_loadu_si128(reinterpret_cast<const __m128i*>(src));
+
+            const __m128i hi_nibbles = _mm_and_si128(_mm_srli_epi32(str, 4), mask_2F);
+            const __m128i lo_nibbles = _mm_and_si128(str, mask_2F);
+            const __m128i hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+            const __m128i lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+
+            if (_mm_testz_si128(lo, hi))
+            {
+                const __m128i eq_2F = _mm_cmpeq_epi8(str, mask_2F);
+                const __m128i roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(eq_2F, hi_nibbles));
+                str = _mm_add_epi8(str, roll);
+
+                str = _mm_maddubs_epi16(str, merge_ab_and_bc);
+                str = _mm_madd_epi16(str, merge_abc);
+                str = _mm_shuffle_epi8(str, pack);
+
+                _mm_storeu_si128(reinterpret_cast<__m128i*>(dest), str);
+            }
+            else
+            {
+                decode_scalar(src, 4, dest);
+            }
+
+            src += 16;
+            dest += 12;
+            numQuads -= 4;
+        }
+
+        decode_scalar(src, numQuads, dest);
+    }
+
+    VSGXCHANGE_TARGET("avx2")
+    void decode_avx2(const char* src, size_t numQuads, uint8_t* dest)
+    {
+        const __m256i lut_lo = _mm256_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A,
+                                                0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1A, 0x1B, 0x1B, 0x1B, 0x1A);
+        const __m256i lut_hi = _mm256_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10,
+                                                0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+        const __m256i lut_roll = _mm256_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0,
+                                                  0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+        const __m256i mask_2F = _mm256_set1_epi8(0x2f);
+        const __m256i merge_ab_and_bc = _mm256_set1_epi32(0x01400140);
+        const __m256i merge_abc = _mm256_set1_epi32(0x00011000);
+        const __m256i pack = _mm256_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1,
+                                              2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1);
+        const __m256i permute = _mm256_setr_epi32(0, 1, 2, 4, 5, 6, -1, -1);
+
+        // each iteration reads 32 characters and writes 32 bytes of which 24 are valid, so stop while the 8 byte overrun is still within dest
+        while (numQuads >= 11)
+        {
+            __m256i str = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(src));
+
+            const __m256i hi_nibbles = _mm256_and_si256(_mm256_srli_epi32(str, 4), mask_2F);
+            const __m256i lo_nibbles = _mm256_and_si256(str, mask_2F);
+            const __m256i hi = _mm256_shuffle_epi8(lut_hi, hi_nibbles);
+            const __m256i lo = _mm256_shuffle_epi8(lut_lo, lo_nibbles);
+
+            if (_mm256_testz_si256(lo, hi))
+            {
+                const __m256i eq_2F = _mm256_cmpeq_epi8(str, mask_2F);
+                const __m256i roll = _mm256_shuffle_epi8(lut_roll, _mm256_add_epi8(eq_2F, hi_nibbles));
+                str = _mm256_add_epi8(str, roll);
+
+                str = _mm256_maddubs_epi16(str, merge_ab_and_bc);
+                str = _mm256_madd_epi16(str, merge_abc);
+                str = _mm256_shuffle_epi8(str, pack);
+                str = _mm256_permutevar8x32_epi32(str, permute);
+
+                _mm256_storeu_si256(reinterpret_cast<__m256i*>(dest), str);
+            }
+            else
+            {
+                decode_scalar(src, 8, dest);
+            }
+
+            src += 32;
+            dest += 24;
+            numQuads -= 8;
+        }
+
+        decode_sse41(src, numQuads, dest);
+    }
+
+    using DecodeFunction = void (*)(const char* src, size_t numQuads, uint8_t* dest);
+
+    DecodeFunction selectDecodeFunction()
+    {
+#    if defined(_MSC_VER)
+        int info[4];
+        __cpuid(info, 0);
+        int maxLevel = info[0];
+
+        bool sse41 = false;
+        bool avx2 = false;
+        if (maxLevel >= 1)
+        {
+            __cpuid(info, 1);
+            sse41 = (info[2] & (1 << 19)) != 0;
+            bool osxsave = (info[2] & (1 << 27)) != 0;
+            bool avx = (info[2] & (1 << 28)) != 0;
+            if (osxsave && avx && maxLevel >= 7 && (_xgetbv(0) & 0x6) == 0x6)
+            {
+                __cpuidex(info, 7, 0);
+                avx2 = (info[1] & (1 << 5)) != 0;
+            }
+        }
+#    else
+        __builtin_cpu_init();
+        bool sse41 = __builtin_cpu_supports("sse4.1");
+        bool avx2 = __builtin_cpu_supports("avx2");
+#    endif
+        if (avx2) return decode_avx2;
+        if (sse41) return decode_sse41;
+        return decode_scalar;
+    }
+
+    void decode_quads(const char* src, size_t numQuads, uint8_t* dest)
+    {
+        static const DecodeFunction s_decode = selectDecodeFunction();
+        s_decode(src, numQuads, dest);
+    }
+#else
+    void decode_quads(const char* src, size_t numQuads, uint8_t* dest)
+    {
+        decode_scalar(src, numQuads, dest);
+    }
+#endif
+
+    struct DecodeBase64Operation : public vsg::Inherit<vsg::Operation, DecodeBase64Operation>
+    {
+        const char* src;
+        size_t numQuads;
+        uint8_t* dest;
+        vsg::ref_ptr<vsg::Latch> latch;
+
+        DecodeBase64Operation(const char* s, size_t n, uint8_t* d, vsg::ref_ptr<vsg::Latch> l) :
+            src(s),
+            numQuads(n),
+            dest(d),
+            latch(l) {}
+
+        void run() override
+        {
+            decode_quads(src, numQuads, dest);
+            latch->count_down();
+        }
+    };
+} // namespace
+
+void gltf::decodeBase64(const std::string_view& encoded, uint8_t* dest, size_t destSize, vsg::ref_ptr<vsg::OperationThreads> operationThreads)
+{
+    size_t numQuads = std::min(encoded.size() / 4, destSize / 3);
+    size_t srcTailCount = encoded.size() - numQuads * 4;
+    size_t destTailCount = destSize - numQuads * 3;
+
+    // only split the decode across threads when there is enough work to amortize the cost of dispatch.
+    const size_t minQuadsPerChunk = 256 * 1024;
+    size_t numChunks = 1;
+    if (operationThreads && !operationThreads->threads.empty())
+    {
+        numChunks = std::min(operationThreads->threads.size() + 1, numQuads / minQuadsPerChunk);
+    }
+
+    if (numChunks > 1)
+    {
+        // keep chunk boundaries on 32 quad boundaries so that each chunk is decoded in whole SIMD blocks.
+        size_t quadsPerChunk = ((numQuads / numChunks) + 31) & ~size_t(31);
+        numChunks = (numQuads + quadsPerChunk - 1) / quadsPerChunk;
+
+        auto latch = vsg::Latch::create(static_cast<int>(numChunks));
+        std::vector<vsg::ref_ptr<vsg::Operation>> operations;
+        for (size_t start = 0; start < numQuads; start += quadsPerChunk)
+        {
+            size_t count = std::min(quadsPerChunk, numQuads - start);
+            operations.push_back(DecodeBase64Operation::create(encoded.data() + start * 4, count, dest + start * 3, latch));
+        }
+
+        operationThreads->add(operations.begin(), operations.end(), vsg::INSERT_FRONT);
+
+        // use this thread to decode chunks as well
+        operationThreads->run();
+
+        latch->wait();
+    }
+    else
+    {
+        decode_quads(encoded.data(), numQuads, dest);
+    }
+
+    const char* src_itr = encoded.data() + numQuads * 4;
+    uint8_t* dest_itr = dest + numQuads * 3;
+
+    if (srcTailCount != 0 && destTailCount != 0)
+    {
+        const uint8_t* lookup = s_lookup.values;
+        const uint8_t decodedBytes[4] = {
+            lookup[static_cast<uint8_t>(src_itr[0])],
+            srcTailCount >= 2 ? lookup[static_cast<uint8_t>(src_itr[1])] : uint8_t(0),
+            srcTailCount >= 3 ? lookup[static_cast<uint8_t>(src_itr[2])] : uint8_t(0),
+            srcTailCount >= 4 ? lookup[static_cast<uint8_t>(src_itr[3])] : uint8_t(0)};
+
+        (*dest_itr++) = static_cast<uint8_t>((decodedBytes[0] << 2) + ((decodedBytes[1] & 0x30) >> 4));
+        if (destTailCount >= 2) (*dest_itr++) = static_cast<uint8_t>(((decodedBytes[1] & 0x0f) << 4) + ((decodedBytes[2] & 0x3c) >> 2));
+        if (destTailCount >= 3) (*dest_itr++) = static_cast<uint8_t>(((decodedBytes[2] & 0x03) << 6) + decodedBytes[3]);
+    }
+
+    // fill in any remaining unassigned bytes to end of dest
+    std::fill(dest_itr, dest + destSize, uint8_t(0));
+}
@@ -5,9 +5,17 @@ if(draco_FOUND)
     OPTION(vsgXchange_draco "Optional glTF draco support provided" ON)
 endif()
 
+# add meshoptimizer support if available
+find_package(meshoptimizer)
+
+if(meshoptimizer_FOUND)
+    OPTION(vsgXchange_meshopt "Optional glTF EXT_meshopt_compression support provided" ON)
+endif()
+
 set(SOURCES ${SOURCES}
     gltf/gltf.cpp
     gltf/Builder.cpp
+    gltf/base64.cpp
 )
 
 if (draco_FOUND AND vsgXchange_draco)
@@ -17,3 +25,10 @@ if (draco_FOUND AND vsgXchange_draco)
         set(FIND_DEPENDENCY ${FIND_DEPENDENCY} "find_dependency(draco)")
     endif()
 endif()
+
+if (meshoptimizer_FOUND AND vsgXchange_meshopt)
+    set(EXTRA_LIBRARIES ${EXTRA_LIBRARIES} meshoptimizer::meshoptimizer)
+    if(NOT BUILD_SHARED_LIBS)
+        set(FIND_DEPENDENCY ${FIND_DEPENDENCY} "find_dependency(meshoptimizer)")
+    endif()
+endif()
@@ -10,6 +10,8 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 
 </editor-fold> */
 
+#include <vsgXchange/DataCache.h>
+#include <vsgXchange/bin.h>
 #include <vsgXchange/gltf.h>
 
 #include <vsg/io/Path.h>
@@ -20,7 +22,12 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/threading/OperationThreads.h>
 #include <vsg/utils/CommandLine.h>
 
+#include <algorithm>
+#include <cstdlib>
+#include <cstring>
 #include <fstream>
+#include <future>
+#include <iterator>
 
 using namespace vsgXchange;
 
@@ -557,6 +564,14 @@ void gltf::KHR_texture_transform::read_number(vsg::JSONParser& parser, const std
         parser.warning();
 }
 
+void gltf::KHR_texture_basisu::read_number(vsg::JSONParser& parser, const std::string_view& property, std::istream& input)
+{
+    if (property == "source")
+        input >> source;
+    else
+        parser.warning();
+}
+
 void gltf::Material::report(vsg::LogOutput& output)
 {
     output.enter("Material {");
@@ -729,6 +744,57 @@ void gltf::KHR_draco_mesh_compression::read_object(vsg::JSONParser& parser, cons
         ExtensionsExtras::read_object(parser, property);
 }
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// EXT_meshopt_compression
+//
+void gltf::EXT_meshopt_compression::report(vsg::LogOutput& output)
+{
+    output.enter("EXT_meshopt_compression {");
+    ExtensionsExtras::report(output);
+    output("buffer = ", buffer);
+    output("byteOffset = ", byteOffset);
+    output("byteLength = ", byteLength);
+    output("byteStride = ", byteStride);
+    output("count = ", count);
+    output("mode = ", mode);
+    output("filter = ", filter);
+    output("fallback = ", fallback);
+    output.leave();
+}
+
+void gltf::EXT_meshopt_compression::read_string(vsg::JSONParser& parser, const std::string_view& property)
+{
+    if (property == "mode") { parser.read_string(mode); }
+    else if (property == "filter") { parser.read_string(filter); }
+    else
+        parser.warning();
+}
+
+void gltf::EXT_meshopt_compression::read_number(vsg::JSONParser& parser, const std::string_view& property, std::istream& input)
+{
+    if (property == "buffer")
+        input >> buffer;
+    else if (property == "byteOffset")
+        input >> byteOffset;
+    else if (property == "byteLength")
+        input >> byteLength;
+    else if (property == "byteStride")
+        input >> byteStride;
+    else if (property == "count")
+        input >> count;
+    else
+        parser.warning();
+}
+
+void gltf::EXT_meshopt_compression::read_bool(vsg::JSONParser& parser, const std::string_view& property, bool value)
+{
+    if (property == "fallback")
+        fallback = value;
+    else
+        parser.warning();
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // Node
@@ -1169,25 +1235,106 @@ void gltf::KHR_lights_punctual::read_array(vsg::JSONParser& parser, const std::s
         parser.warning();
 };
 
+////////////////////////////////////////////////////////////////////////////////////////////////////
+//
+// Summary
+//
+void gltf::Summary::addBounds(const vsg::dbox& box, const vsg::dmat4& matrix)
+{
+    if (!box.valid()) return;
+
+    for (int i = 0; i < 8; ++i)
+    {
+        bounds.add(matrix * vsg::dvec3((i & 1) ? box.max.x : box.min.x, (i & 2) ? box.max.y : box.min.y, (i & 4) ? box.max.z : box.min.z));
+    }
+}
+
+void gltf::Summary::add(const Summary& summary, const vsg::dmat4& matrix, uint64_t instances)
+{
+    addBounds(summary.bounds, matrix);
+    nodeCount += summary.nodeCount;
+    meshCount += summary.meshCount;
+    primitiveCount += summary.primitiveCount * instances;
+    vertexCount += summary.vertexCount * instances;
+    triangleCount += summary.triangleCount * instances;
+    bufferBytes += summary.bufferBytes;
+    images.insert(images.end(), summary.images.begin(), summary.images.end());
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // glTF
 //
+namespace
+{
+    // glTF::prune() leaves null entries for the objects it releases so skip them when reporting.
+    template<class T>
+    void reportObjects(vsg::ObjectsSchema<T>& objects, vsg::LogOutput& output)
+    {
+        for (auto& object : objects.values)
+        {
+            if (object) object->report(output);
+        }
+    }
+
+    template<typename F>
+    void forEachTextureInfo(gltf::Material& material, F func)
+    {
+        func(material.pbrMetallicRoughness.baseColorTexture);
+        func(material.pbrMetallicRoughness.metallicRoughnessTexture);
+        func(material.normalTexture);
+        func(material.occlusionTexture);
+        func(material.emissiveTexture);
+
+        if (auto materials_specular = material.extension<gltf::KHR_materials_specular>("KHR_materials_specular"))
+        {
+            func(materials_specular->specularTexture);
+            func(materials_specular->specularColorTexture);
+        }
+
+        if (auto materials_pbrSpecularGlossiness = material.extension<gltf::KHR_materials_pbrSpecularGlossiness>("KHR_materials_pbrSpecularGlossiness"))
+        {
+            func(materials_pbrSpecularGlossiness->diffuseTexture);
+            func(materials_pbrSpecularGlossiness->specularGlossinessTexture);
+        }
+    }
+
+    // find object by name, or failing that by index.
+    template<class T>
+    gltf::glTFid findObject(const vsg::ObjectsSchema<T>& objects, const std::string& name)
+    {
+        gltf::glTFid id;
+        for (size_t i = 0; i < objects.values.size(); ++i)
+        {
+            if (objects.values[i] && objects.values[i]->name == name)
+            {
+                id.value = static_cast<uint32_t>(i);
+                return id;
+            }
+        }
+
+        char* end = nullptr;
+        auto index = std::strtoul(name.c_str(), &end, 10);
+        if (end != name.c_str() && *end == 0 && index < objects.values.size()) id.value = static_cast<uint32_t>(index);
+        return id;
+    }
+} // namespace
+
 void gltf::glTF::report(vsg::LogOutput& output)
 {
     output.enter("glTF {");
     if (asset) asset->report(output);
-    accessors.report(output);
-    bufferViews.report(output);
-    buffers.report(output);
-    images.report(output);
-    materials.report(output);
-    meshes.report(output);
-    nodes.report(output);
+    reportObjects(accessors, output);
+    reportObjects(bufferViews, output);
+    reportObjects(buffers, output);
+    reportObjects(images, output);
+    reportObjects(materials, output);
+    reportObjects(meshes, output);
+    reportObjects(nodes, output);
     samplers.report(output);
-    textures.report(output);
+    reportObjects(textures, output);
     animations.report(output);
-    skins.report(output);
+    reportObjects(skins, output);
     cameras.report(output);
     output("scene = ", scene);
     scenes.report(output);
@@ -1249,6 +1396,287 @@ void gltf::glTF::read_number(vsg::JSONParser& parser, const std::string_view& pr
         parser.warning();
 }
 
+void gltf::glTF::prune(vsg::ref_ptr<const vsg::Options> options)
+{
+    std::string sceneName;
+    std::string nodeNames;
+    bool selectScene = options && options->getValue(gltf::load_scene, sceneName);
+    bool selectNodes = options && options->getValue(gltf::load_nodes, nodeNames);
+    bool skipAnimations = vsg::value<bool>(false, gltf::skip_animations, options);
+    bool skipCameras = vsg::value<bool>(false, gltf::skip_cameras, options);
+    bool skipLights = vsg::value<bool>(false, gltf::skip_lights, options);
+    bool skipTextures = vsg::value<bool>(false, gltf::skip_textures, options);
+
+    if (!selectScene && !selectNodes && !skipAnimations && !skipCameras && !skipLights && !skipTextures) return;
+
+    if (skipAnimations) animations.values.clear();
+
+    if (skipCameras)
+    {
+        cameras.values.clear();
+        for (auto& node : nodes.values) node->camera = glTFid{};
+    }
+
+    if (skipLights)
+    {
+        if (auto khr_lights = extension<KHR_lights_punctual>("KHR_lights_punctual")) khr_lights->lights.values.clear();
+    }
+
+    if (skipTextures)
+    {
+        for (auto& material : materials.values)
+        {
+            forEachTextureInfo(*material, [](TextureInfo& textureInfo) { textureInfo.index = glTFid{}; });
+        }
+    }
+
+    if (selectScene)
+    {
+        glTFid id = (sceneName == "default") ? scene : findObject(scenes, sceneName);
+        if (!id && sceneName == "default" && !scenes.values.empty()) id.value = 0;
+
+        if (id && id.value < scenes.values.size())
+        {
+            auto selected = scenes.values[id.value];
+            scenes.values.assign(1, selected);
+            scene.value = 0;
+        }
+        else
+        {
+            vsg::warn("gltf::glTF::prune() ", gltf::load_scene, " ", sceneName, " not found, loading all scenes.");
+        }
+    }
+
+    if (selectNodes)
+    {
+        std::vector<bool> selected(nodes.values.size(), false);
+        for (size_t pos = 0; pos < nodeNames.size();)
+        {
+            auto comma = std::min(nodeNames.find(',', pos), nodeNames.size());
+            auto first = nodeNames.find_first_not_of(" \t", pos);
+            auto last = nodeNames.find_last_not_of(" \t", comma - 1);
+            if (first < comma && last != std::string::npos && last >= first)
+            {
+                auto name = nodeNames.substr(first, last - first + 1);
+                if (auto id = findObject(nodes, name))
+                    selected[id.value] = true;
+                else
+                    vsg::warn("gltf::glTF::prune() ", gltf::load_nodes, " node ", name, " not found.");
+            }
+            pos = comma + 1;
+        }
+
+        std::vector<glTFid> parents(nodes.values.size());
+        for (size_t ni = 0; ni < nodes.values.size(); ++ni)
+        {
+            for (auto& child : nodes.values[ni]->children.values)
+            {
+                if (child.value < parents.size()) parents[child.value].value = static_cast<uint32_t>(ni);
+            }
+        }
+
+        // ancestors of the selected nodes are kept so the selected nodes keep their place in the scene.
+        std::vector<bool> ancestor(nodes.values.size(), false);
+        for (size_t ni = 0; ni < nodes.values.size(); ++ni)
+        {
+            if (!selected[ni]) continue;
+            for (auto parent = parents[ni]; parent && !ancestor[parent.value]; parent = parents[parent.value])
+            {
+                ancestor[parent.value] = true;
+            }
+        }
+
+        auto keep = [&](const glTFid& id) { return id.value < selected.size() && (selected[id.value] || ancestor[id.value]); };
+
+        for (size_t ni = 0; ni < nodes.values.size(); ++ni)
+        {
+            if (!ancestor[ni] || selected[ni]) continue;
+
+            // ancestors only contribute their transform
+            auto& node = nodes.values[ni];
+            auto& children = node->children.values;
+            children.erase(std::remove_if(children.begin(), children.end(), [&](const glTFid& id) { return !keep(id); }), children.end());
+            node->mesh = glTFid{};
+            node->camera = glTFid{};
+            node->skin = glTFid{};
+        }
+
+        std::vector<bool> inScene(nodes.values.size(), false);
+        for (auto& gltf_scene : scenes.values)
+        {
+            auto& roots = gltf_scene->nodes.values;
+            roots.erase(std::remove_if(roots.begin(), roots.end(), [&](const glTFid& id) { return !keep(id); }), roots.end());
+            for (auto& id : roots) inScene[id.value] = true;
+        }
+
+        // selected root nodes that aren't referenced by a scene are added to the first scene.
+        for (size_t ni = 0; ni < nodes.values.size(); ++ni)
+        {
+            if ((selected[ni] || ancestor[ni]) && !parents[ni] && !inScene[ni])
+            {
+                if (scenes.values.empty()) scenes.values.push_back(Scene::create());
+
+                glTFid id;
+                id.value = static_cast<uint32_t>(ni);
+                scenes.values.front()->nodes.values.push_back(id);
+            }
+        }
+
+        scenes.values.erase(std::remove_if(scenes.values.begin(), scenes.values.end(), [](const vsg::ref_ptr<Scene>& gltf_scene) { return gltf_scene->nodes.values.empty(); }), scenes.values.end());
+        if (!scenes.values.empty()) scene.value = 0;
+    }
+
+    // mark everything reachable from the scenes that remain
+    std::vector<bool> usedNodes(nodes.values.size(), false);
+    std::vector<bool> usedMeshes(meshes.values.size(), false);
+    std::vector<bool> usedSkins(skins.values.size(), false);
+    std::vector<bool> usedMaterials(materials.values.size(), false);
+    std::vector<bool> usedTextures(textures.values.size(), false);
+    std::vector<bool> usedImages(images.values.size(), false);
+    std::vector<bool> usedAccessors(accessors.values.size(), false);
+    std::vector<bool> usedBufferViews(bufferViews.values.size(), false);
+    std::vector<bool> usedBuffers(buffers.values.size(), false);
+
+    auto use = [](std::vector<bool>& used, const glTFid& id) {
+        if (!id || id.value >= used.size() || used[id.value]) return false;
+        used[id.value] = true;
+        return true;
+    };
+
+    auto useAttributes = [&](const Attributes& attributes) {
+        for (auto& [name, id] : attributes.values) use(usedAccessors, id);
+    };
+
+    std::vector<glTFid> nodeStack;
+    auto useNode = [&](const glTFid& id) {
+        if (use(usedNodes, id)) nodeStack.push_back(id);
+    };
+
+    for (auto& gltf_scene : scenes.values)
+    {
+        for (auto& id : gltf_scene->nodes.values) useNode(id);
+    }
+
+    while (!nodeStack.empty())
+    {
+        auto& node = nodes.values[nodeStack.back().value];
+        nodeStack.pop_back();
+
+        for (auto& id : node->children.values) useNode(id);
+
+        use(usedMeshes, node->mesh);
+
+        if (use(usedSkins, node->skin))
+        {
+            auto& skin = skins.values[node->skin.value];
+            use(usedAccessors, skin->inverseBindMatrices);
+            useNode(skin->skeleton);
+            for (auto& id : skin->joints.values) useNode(id);
+        }
+
+        if (auto mesh_gpu_instancing = node->extension<EXT_mesh_gpu_instancing>("EXT_mesh_gpu_instancing"); mesh_gpu_instancing && mesh_gpu_instancing->attributes)
+        {
+            useAttributes(*mesh_gpu_instancing->attributes);
+        }
+    }
+
+    for (size_t mi = 0; mi < meshes.values.size(); ++mi)
+    {
+        if (!usedMeshes[mi]) continue;
+        for (auto& primitive : meshes.values[mi]->primitives.values)
+        {
+            useAttributes(primitive->attributes);
+            use(usedAccessors, primitive->indices);
+            use(usedMaterials, primitive->material);
+            for (auto& target : primitive->targets.values) useAttributes(*target);
+
+            if (auto draco_mesh_compression = primitive->extension<KHR_draco_mesh_compression>("KHR_draco_mesh_compression"))
+            {
+                use(usedBufferViews, draco_mesh_compression->bufferView);
+            }
+        }
+    }
+
+    for (size_t mi = 0; mi < materials.values.size(); ++mi)
+    {
+        if (usedMaterials[mi]) forEachTextureInfo(*materials.values[mi], [&](TextureInfo& textureInfo) { use(usedTextures, textureInfo.index); });
+    }
+
+    for (size_t ti = 0; ti < textures.values.size(); ++ti)
+    {
+        if (!usedTextures[ti]) continue;
+
+        auto& texture = textures.values[ti];
+        use(usedImages, texture->source);
+        if (auto texture_basisu = texture->extension<KHR_texture_basisu>("KHR_texture_basisu")) use(usedImages, texture_basisu->source);
+    }
+
+    // keep only the animation channels that target the remaining nodes
+    for (auto& animation : animations.values)
+    {
+        auto& channels = animation->channels.values;
+        channels.erase(std::remove_if(channels.begin(), channels.end(), [&](const vsg::ref_ptr<AnimationChannel>& channel) {
+            return !channel->target.node || channel->target.node.value >= usedNodes.size() || !usedNodes[channel->target.node.value];
+        }), channels.end());
+
+        for (auto& channel : channels)
+        {
+            if (channel->sampler.value < animation->samplers.values.size())
+            {
+                auto& sampler = animation->samplers.values[channel->sampler.value];
+                use(usedAccessors, sampler->input);
+                use(usedAccessors, sampler->output);
+            }
+        }
+    }
+    animations.values.erase(std::remove_if(animations.values.begin(), animations.values.end(), [](const vsg::ref_ptr<Animation>& animation) { return animation->channels.values.empty(); }), animations.values.end());
+
+    for (size_t ai = 0; ai < accessors.values.size(); ++ai)
+    {
+        if (!usedAccessors[ai]) continue;
+
+        auto& accessor = accessors.values[ai];
+        use(usedBufferViews, accessor->bufferView);
+        if (accessor->sparse)
+        {
+            if (accessor->sparse->indices) use(usedBufferViews, accessor->sparse->indices->bufferView);
+            if (accessor->sparse->values) use(usedBufferViews, accessor->sparse->values->bufferView);
+        }
+    }
+
+    for (size_t ii = 0; ii < images.values.size(); ++ii)
+    {
+        if (usedImages[ii] && images.values[ii]) use(usedBufferViews, images.values[ii]->bufferView);
+    }
+
+    for (size_t bvi = 0; bvi < bufferViews.values.size(); ++bvi)
+    {
+        if (!usedBufferViews[bvi]) continue;
+
+        auto& bufferView = bufferViews.values[bvi];
+        use(usedBuffers, bufferView->buffer);
+        if (auto meshopt_compression = bufferView->extension<EXT_meshopt_compression>("EXT_meshopt_compression")) use(usedBuffers, meshopt_compression->buffer);
+    }
+
+    // release everything that isn't used.
+    auto release = [](auto& objects, const std::vector<bool>& used) {
+        for (size_t i = 0; i < objects.values.size(); ++i)
+        {
+            if (!used[i]) objects.values[i] = {};
+        }
+    };
+
+    release(nodes, usedNodes);
+    release(meshes, usedMeshes);
+    release(skins, usedSkins);
+    release(materials, usedMaterials);
+    release(textures, usedTextures);
+    release(images, usedImages);
+    release(accessors, usedAccessors);
+    release(bufferViews, usedBufferViews);
+    release(buffers, usedBuffers);
+}
+
 void gltf::glTF::resolveURIs(vsg::ref_ptr<const vsg::Options> options)
 {
     vsg::ref_ptr<vsg::OperationThreads> operationThreads;
@@ -1304,6 +1732,7 @@ void gltf::glTF::resolveURIs(vsg::ref_ptr<const vsg::Options> options)
         vsg::ref_ptr<BufferView> bufferView;
         vsg::ref_ptr<const vsg::Options> options;
         vsg::ref_ptr<vsg::Data>& data;
+        vsg::ref_ptr<DataCache> imageCache;
 
         ReadBufferOperation(vsg::ref_ptr<Buffer> b, uint32_t offset, uint32_t length, vsg::ref_ptr<const vsg::Options> o, vsg::ref_ptr<vsg::Data>& d, vsg::ref_ptr<vsg::Latch> l = {}) :
             Inherit(l),
@@ -1323,7 +1752,10 @@ void gltf::glTF::resolveURIs(vsg::ref_ptr<const vsg::Options> options)
 
             auto ptr = reinterpret_cast<uint8_t*>(buffer->data->dataPointer()) + byteOffset;
 
-            data = vsg::read_cast<vsg::Data>(ptr, byteLength, options);
+            if (imageCache)
+                data = imageCache->read(ptr, byteLength, options);
+            else
+                data = vsg::read_cast<vsg::Data>(ptr, byteLength, options);
 
             //vsg::info("Read buffer byteLength = ", byteLength, ", data = ", data);
             // if (data) vsg::write(data, vsg::make_string("image_", byteOffset,".png"), options);
@@ -1340,6 +1772,7 @@ void gltf::glTF::resolveURIs(vsg::ref_ptr<const vsg::Options> options)
         vsg::ref_ptr<const vsg::Options> options;
         uint32_t byteLength;
         vsg::ref_ptr<vsg::Data>& data;
+        vsg::ref_ptr<DataCache> imageCache;
 
         DecodeOperation(const std::string_view& m, const std::string_view& e, const std::string_view& v, vsg::ref_ptr<const vsg::Options> o, vsg::ref_ptr<vsg::Data>& d, uint32_t bl, vsg::ref_ptr<vsg::Latch> l = {}) :
             Inherit(l),
@@ -1363,15 +1796,6 @@ void gltf::glTF::resolveURIs(vsg::ref_ptr<const vsg::Options> options)
                     return false;
                 };
 
-                auto decode_base64 = [](char c) -> uint8_t {
-                    if (c >= 'A' && c <= 'Z') return c - 'A';
-                    if (c >= 'a' && c <= 'z') return c - 'a' + 26;
-                    if (c >= '0' && c <= '9') return c - '0' + 52;
-                    if (c == '+') return 62;
-                    if (c == '/') return 63;
-                    return 0;
-                };
-
                 while (!value.empty() && !valid_base64(value.back()))
                 {
                     value.remove_suffix(1);
@@ -1379,52 +1803,12 @@ void gltf::glTF::resolveURIs(vsg::ref_ptr<const vsg::Options> options)
 
                 size_t decodedSize = (value.size() * 6) / 8;
 
-                // set up a lookup table to speed up the mapping between encoded to decoded char
-                uint8_t lookup[256];
-                for (uint32_t c = 0; c < 256; ++c)
-                {
-                    lookup[c] = decode_base64(c);
-                }
-
                 uint32_t lengthToUse = std::min(byteLength, static_cast<uint32_t>(decodedSize));
 
                 // data to stored the decoded data.
                 auto decodedData = vsg::ubyteArray::create(lengthToUse);
 
-                // process 4 byte source into 3 byte destination
-                auto dest_itr = decodedData->begin();
-                auto src_itr = value.begin();
-
-                size_t count = std::min(value.size() / 4, size_t(lengthToUse) / 3);
-                size_t srcTailCount = value.size() - count * 4;
-                size_t destTailCount = lengthToUse - count * 3;
-                for (; count > 0; --count)
-                {
-                    const uint8_t decodedBytes[4] = {lookup[static_cast<uint8_t>(*(src_itr++))], lookup[static_cast<uint8_t>(*(src_itr++))], lookup[static_cast<uint8_t>(*(src_itr++))], lookup[static_cast<uint8_t>(*(src_itr++))]};
-
-                    (*dest_itr++) = (decodedBytes[0] << 2) + ((decodedBytes[1] & 0x30) >> 4);
-                    (*dest_itr++) = ((decodedBytes[1] & 0x0f) << 4) + ((decodedBytes[2] & 0x3c) >> 2);
-                    (*dest_itr++) = ((decodedBytes[2] & 0x03) << 6) + decodedBytes[3];
-                }
-
-                if (srcTailCount != 0 && destTailCount != 0)
-                {
-                    const uint8_t decodedBytes[4] = {
-                        lookup[static_cast<uint8_t>(*(src_itr++))],
-                        srcTailCount >= 2 ? lookup[static_cast<uint8_t>(*(src_itr++))] : uint8_t(0),
-                        srcTailCount >= 3 ? lookup[static_cast<uint8_t>(*(src_itr++))] : uint8_t(0),
-                        srcTailCount >= 4 ? lookup[static_cast<uint8_t>(*(src_itr++))] : uint8_t(0)};
-
-                    (*dest_itr++) = (decodedBytes[0] << 2) + ((decodedBytes[1] & 0x30) >> 4);
-                    if (destTailCount >= 2) (*dest_itr++) = ((decodedBytes[1] & 0x0f) << 4) + ((decodedBytes[2] & 0x3c) >> 2);
-                    if (destTailCount >= 3) (*dest_itr++) = ((decodedBytes[2] & 0x03) << 6) + decodedBytes[3];
-                }
-
-                // fill in any remaining unassigned bytes to end of decodedData container
-                for (; dest_itr != decodedData->end(); ++dest_itr)
-                {
-                    *dest_itr = 0;
-                }
+                gltf::decodeBase64(value, decodedData->data(), lengthToUse, options ? options->operationThreads : vsg::ref_ptr<vsg::OperationThreads>());
 
                 if (mimeType.compare(0, 6, "image/") == 0)
                 {
@@ -1433,7 +1817,11 @@ void gltf::glTF::resolveURIs(vsg::ref_ptr<const vsg::Options> options)
                         auto local_options = vsg::clone(options);
                         local_options->extensionHint = extensionHint;
 
-                        data = vsg::read_cast<vsg::Data>(reinterpret_cast<const uint8_t*>(decodedData->dataPointer()), decodedData->dataSize(), local_options);
+                        auto ptr = reinterpret_cast<const uint8_t*>(decodedData->dataPointer());
+                        if (imageCache)
+                            data = imageCache->read(ptr, decodedData->dataSize(), local_options);
+                        else
+                            data = vsg::read_cast<vsg::Data>(ptr, decodedData->dataSize(), local_options);
                         if (data)
                         {
                             vsg::debug("read decoded data [", decodedData->dataSize(), ", ", extensionHint, "] dimensions = {", data->width(), ", ", data->height(), "}");
@@ -1464,12 +1852,19 @@ void gltf::glTF::resolveURIs(vsg::ref_ptr<const vsg::Options> options)
         }
     };
 
+    // embedded images are shared with other loads that use the same sharedObjects, so repeated images are only decoded once.
+    vsg::ref_ptr<DataCache> imageCache;
+    if (vsg::value<bool>(false, gltf::share_images, options))
+    {
+        imageCache = (options && options->sharedObjects) ? options->sharedObjects->shareDefault<DataCache>() : DataCache::create();
+    }
+
     std::vector<vsg::ref_ptr<OperationWithLatch>> operations;
     std::vector<vsg::ref_ptr<OperationWithLatch>> secondary_operations;
 
     for (auto& buffer : buffers.values)
     {
-        if (!buffer->data && !buffer->uri.empty())
+        if (buffer && !buffer->data && !buffer->uri.empty())
         {
             std::string_view mimeType;
             std::string_view encoding;
@@ -1487,7 +1882,7 @@ void gltf::glTF::resolveURIs(vsg::ref_ptr<const vsg::Options> options)
 
     for (auto& image : images.values)
     {
-        if (!image->data)
+        if (image && !image->data)
         {
             if (!image->uri.empty())
             {
@@ -1496,7 +1891,9 @@ void gltf::glTF::resolveURIs(vsg::ref_ptr<const vsg::Options> options)
                 std::string_view value;
                 if (dataURI(image->uri, mimeType, encoding, value))
                 {
-                    operations.push_back(DecodeOperation::create(mimeType, encoding, value, options, image->data, std::numeric_limits<uint32_t>::max()));
+                    auto decodeOperation = DecodeOperation::create(mimeType, encoding, value, options, image->data, std::numeric_limits<uint32_t>::max());
+                    decodeOperation->imageCache = imageCache;
+                    operations.push_back(decodeOperation);
                 }
                 else
                 {
@@ -1513,7 +1910,9 @@ void gltf::glTF::resolveURIs(vsg::ref_ptr<const vsg::Options> options)
                     auto local_options = vsg::clone(options);
                     local_options->extensionHint = extensionHint;
 
-                    secondary_operations.push_back(ReadBufferOperation::create(buffer, bufferView->byteOffset, bufferView->byteLength, local_options, image->data));
+                    auto readBufferOperation = ReadBufferOperation::create(buffer, bufferView->byteOffset, bufferView->byteLength, local_options, image->data);
+                    readBufferOperation->imageCache = imageCache;
+                    secondary_operations.push_back(readBufferOperation);
                 }
             }
             else
@@ -1595,20 +1994,29 @@ bool gltf::supportedExtension(const vsg::Path& ext) const
 
 vsg::ref_ptr<vsg::Object> gltf::read_gltf(std::istream& fin, vsg::ref_ptr<const vsg::Options> options, const vsg::Path& filename) const
 {
-    fin.seekg(0, fin.end);
-    size_t fileSize = fin.tellg();
-
-    if (fileSize == 0) return {};
-
     vsg::JSONParser parser;
     parser.options = options;
 
     // set up the supported extensions
     assignExtensions(parser);
 
-    parser.buffer.resize(fileSize);
-    fin.seekg(0);
-    fin.read(reinterpret_cast<char*>(parser.buffer.data()), fileSize);
+    fin.seekg(0, fin.end);
+    auto fileSize = fin.tellg();
+    if (fileSize >= 0)
+    {
+        if (fileSize == 0) return {};
+
+        parser.buffer.resize(static_cast<size_t>(fileSize));
+        fin.seekg(0);
+        fin.read(reinterpret_cast<char*>(parser.buffer.data()), fileSize);
+    }
+    else
+    {
+        // streams that can't seek, such as in flight downloads, are read sequentially to their end.
+        fin.clear();
+        parser.buffer.assign(std::istreambuf_iterator<char>(fin), std::istreambuf_iterator<char>());
+        if (parser.buffer.empty()) return {};
+    }
 
     vsg::ref_ptr<vsg::Object> result;
 
@@ -1630,14 +2038,6 @@ vsg::ref_ptr<vsg::Object> gltf::read_gltf(std::istream& fin, vsg::ref_ptr<const
             return {};
         }
 
-        root->resolveURIs(options);
-
-        if (vsg::value<bool>(false, gltf::report, options))
-        {
-            vsg::LogOutput output;
-            root->report(output);
-        }
-
         auto builder = vsg::clone<gltf::Builder>(gltf::prototype_builder, options);
 
         if (options)
@@ -1649,6 +2049,20 @@ vsg::ref_ptr<vsg::Object> gltf::read_gltf(std::istream& fin, vsg::ref_ptr<const
             }
         }
 
+        if (vsg::value<bool>(false, gltf::probe, options))
+        {
+            return builder->createSummary(root, options);
+        }
+
+        root->prune(options);
+        root->resolveURIs(options);
+
+        if (vsg::value<bool>(false, gltf::report, options))
+        {
+            vsg::LogOutput output;
+            root->report(output);
+        }
+
         result = builder->createSceneGraph(root, options);
     }
     else
@@ -1661,8 +2075,7 @@ vsg::ref_ptr<vsg::Object> gltf::read_gltf(std::istream& fin, vsg::ref_ptr<const
 
 vsg::ref_ptr<vsg::Object> gltf::read_glb(std::istream& fin, vsg::ref_ptr<const vsg::Options> options, const vsg::Path& filename) const
 {
-    fin.seekg(0);
-
+    // the header and chunks are read sequentially without seeking so that non seekable streams, such as in flight downloads, can be read.
     struct Header
     {
         char magic[4] = {0, 0, 0, 0};
@@ -1708,19 +2121,121 @@ vsg::ref_ptr<vsg::Object> gltf::read_glb(std::istream& fin, vsg::ref_ptr<const v
 
     parser.buffer.resize(jsonSize);
     fin.read(reinterpret_cast<char*>(parser.buffer.data()), jsonSize);
-
-    Chunk chunk1;
-    fin.read(reinterpret_cast<char*>(&chunk1), sizeof(Chunk));
     if (!fin.good())
     {
         vsg::warn("IO error reading GLB file.");
         return {};
     }
 
-    uint32_t binarySize = chunk1.chunkLength; // - sizeof(Chunk);
-    auto binaryData = vsg::ubyteArray::create(binarySize);
-    fin.read(reinterpret_cast<char*>(binaryData->dataPointer()), binarySize);
+    // read the binary chunk on a separate thread so it can still be arriving while the JSON is parsed,
+    // the stream isn't touched by this thread again and the future's destructor waits for the read to finish.
+    auto binaryChunk = std::async(std::launch::async, [&fin]() -> vsg::ref_ptr<vsg::Data> {
+        Chunk chunk1;
+        fin.read(reinterpret_cast<char*>(&chunk1), sizeof(Chunk));
+        if (!fin.good())
+        {
+            // the binary chunk is optional so only report a partially read chunk header.
+            if (fin.gcount() != 0) vsg::warn("IO error reading GLB file.");
+            return {};
+        }
+
+        uint32_t binarySize = chunk1.chunkLength; // - sizeof(Chunk);
+        auto binaryData = vsg::ubyteArray::create(binarySize);
+        fin.read(reinterpret_cast<char*>(binaryData->dataPointer()), binarySize);
+        if (fin.gcount() != static_cast<std::streamsize>(binarySize))
+        {
+            vsg::warn("IO error reading GLB file, binary chunk truncated.");
+            return {};
+        }
+
+        return binaryData;
+    });
+
+    return read_glb_json(parser, [&binaryChunk]() { return binaryChunk.get(); }, options, filename);
+}
+
+vsg::ref_ptr<vsg::Object> gltf::read_glb(vsg::ref_ptr<vsg::ubyteArray> glb, vsg::ref_ptr<const vsg::Options> options, const vsg::Path& filename) const
+{
+    struct Header
+    {
+        char magic[4] = {0, 0, 0, 0};
+        uint32_t version = 0;
+        uint32_t length = 0;
+    };
+
+    struct Chunk
+    {
+        uint32_t chunkLength = 0;
+        uint32_t chunkType = 0;
+    };
+
+    const uint8_t* ptr = glb ? glb->data() : nullptr;
+    size_t size = glb ? glb->dataSize() : 0;
+
+    if (size < sizeof(Header) + sizeof(Chunk))
+    {
+        vsg::warn("IO error reading GLB file, filename = ", filename);
+        return {};
+    }
+
+    Header header;
+    std::memcpy(&header, ptr, sizeof(Header));
+    if (strncmp(header.magic, "glTF", 4) != 0)
+    {
+        vsg::warn("magic number not glTF, header.magic = ", header.magic);
+        return {};
+    }
+
+    size_t pos = sizeof(Header);
+
+    Chunk chunk0;
+    std::memcpy(&chunk0, ptr + pos, sizeof(Chunk));
+    pos += sizeof(Chunk);
 
+    uint32_t jsonSize = chunk0.chunkLength;
+    if (pos + jsonSize > size)
+    {
+        vsg::warn("IO error reading GLB file, JSON chunk exceeds file size.");
+        return {};
+    }
+
+    vsg::JSONParser parser;
+    parser.options = options;
+
+    // set up the supported extensions
+    assignExtensions(parser);
+
+    parser.buffer.assign(reinterpret_cast<const char*>(ptr + pos), jsonSize);
+    pos += jsonSize;
+
+    vsg::ref_ptr<vsg::Data> binaryData;
+    if (pos + sizeof(Chunk) <= size)
+    {
+        Chunk chunk1;
+        std::memcpy(&chunk1, ptr + pos, sizeof(Chunk));
+        pos += sizeof(Chunk);
+
+        uint32_t binarySize = chunk1.chunkLength;
+        if (pos + binarySize > size)
+        {
+            vsg::warn("IO error reading GLB file, binary chunk exceeds file size.");
+            return {};
+        }
+
+        // reference the binary chunk in place, glb is kept alive as the storage of the view
+        binaryData = vsg::ubyteArray::create(glb, static_cast<uint32_t>(pos), 1, binarySize);
+    }
+
+    return read_glb_json(parser, binaryData, options, filename);
+}
+
+vsg::ref_ptr<vsg::Object> gltf::read_glb_json(vsg::JSONParser& parser, vsg::ref_ptr<vsg::Data> binaryData, vsg::ref_ptr<const vsg::Options> options, const vsg::Path& filename) const
+{
+    return read_glb_json(parser, [&binaryData]() { return binaryData; }, options, filename);
+}
+
+vsg::ref_ptr<vsg::Object> gltf::read_glb_json(vsg::JSONParser& parser, const std::function<vsg::ref_ptr<vsg::Data>()>& readBinaryData, vsg::ref_ptr<const vsg::Options> options, const vsg::Path& filename) const
+{
     vsg::ref_ptr<vsg::Object> result;
 
     // skip white space
@@ -1744,27 +2259,48 @@ vsg::ref_ptr<vsg::Object> gltf::read_glb(std::istream& fin, vsg::ref_ptr<const v
             return {};
         }
 
-        if (root->buffers.values.size() >= 1)
+        if (auto binaryData = readBinaryData())
         {
-            auto& firstBuffer = root->buffers.values.front();
-            if (firstBuffer->uri.empty() && firstBuffer->byteLength == binarySize)
+            auto binarySize = binaryData->dataSize();
+            if (root->buffers.values.size() >= 1)
             {
-                firstBuffer->data = binaryData;
+                auto& firstBuffer = root->buffers.values.front();
+                if (firstBuffer->uri.empty() && firstBuffer->byteLength == binarySize)
+                {
+                    firstBuffer->data = binaryData;
+                }
+                else
+                {
+                    vsg::warn("First glTF Buffer not comptible with binary data");
+                }
             }
             else
             {
-                vsg::warn("First glTF Buffer not comptible with binary data");
+                auto binaryBuffer = Buffer::create();
+                binaryBuffer->byteLength = static_cast<uint32_t>(binarySize);
+                binaryBuffer->data = binaryData;
+
+                root->buffers.values.push_back(binaryBuffer);
             }
         }
-        else
+
+        auto builder = vsg::clone<gltf::Builder>(gltf::prototype_builder, options);
+
+        if (options)
         {
-            auto binaryBuffer = Buffer::create();
-            binaryBuffer->byteLength = binarySize;
-            binaryBuffer->data = binaryData;
+            vsg::Path ext = (options->extensionHint) ? options->extensionHint : vsg::lowerCaseFileExtension(filename);
+            if (auto itr = options->formatCoordinateConventions.find(ext); itr != options->formatCoordinateConventions.end())
+            {
+                builder->source_coordinateConvention = itr->second;
+            }
+        }
 
-            root->buffers.values.push_back(binaryBuffer);
+        if (vsg::value<bool>(false, gltf::probe, options))
+        {
+            return builder->createSummary(root, options);
         }
 
+        root->prune(options);
         root->resolveURIs(options);
 
         if (vsg::value<bool>(false, gltf::report, options))
@@ -1774,17 +2310,6 @@ vsg::ref_ptr<vsg::Object> gltf::read_glb(std::istream& fin, vsg::ref_ptr<const v
             root->report(output);
         }
 
-        auto builder = vsg::clone<gltf::Builder>(gltf::prototype_builder, options);
-
-        if (options)
-        {
-            vsg::Path ext = (options->extensionHint) ? options->extensionHint : vsg::lowerCaseFileExtension(filename);
-            if (auto itr = options->formatCoordinateConventions.find(ext); itr != options->formatCoordinateConventions.end())
-            {
-                builder->source_coordinateConvention = itr->second;
-            }
-        }
-
         result = builder->createSceneGraph(root, options);
 
         if (result && filename) result->setValue("gltf", filename);
@@ -1809,7 +2334,15 @@ vsg::ref_ptr<vsg::Object> gltf::read(const vsg::Path& filename, vsg::ref_ptr<con
     auto opt = vsg::clone(options);
     opt->paths.insert(opt->paths.begin(), vsg::filePath(filenameToUse));
 
-    std::ifstream fin(filenameToUse, std::ios::ate | std::ios::binary);
+    if (ext == ".glb" && vsg::value<bool>(false, gltf::memory_map, options))
+    {
+        if (auto mapped = MappedData::create(filenameToUse))
+            return read_glb(mapped, opt, filename);
+        else
+            vsg::info("gltf::read(", filename, ") unable to memory map file, falling back to reading via std::ifstream.");
+    }
+
+    std::ifstream fin(filenameToUse, std::ios::binary);
 
     if (ext == ".gltf")
         return read_gltf(fin, opt, filename);
@@ -1850,8 +2383,31 @@ bool gltf::readOptions(vsg::Options& options, vsg::CommandLine& arguments) const
     bool result = arguments.readAndAssign<bool>(gltf::report, &options);
     result = arguments.readAndAssign<bool>(gltf::culling, &options) || result;
     result = arguments.readAndAssign<bool>(gltf::disable_gltf, &options) || result;
+    result = arguments.readAndAssign<float>(gltf::animation_sample_rate, &options) || result;
+    result = arguments.readAndAssign<float>(gltf::animation_tolerance, &options) || result;
     result = arguments.readAndAssign<bool>(gltf::clone_accessors, &options) || result;
+    result = arguments.readAndAssign<uint32_t>(gltf::cluster_size, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::compact_buffers, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::compress_vertices, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::flatten_static_transforms, &options) || result;
+    result = arguments.readAndAssign<uint32_t>(gltf::instance_threshold, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::interleaved_vertices, &options) || result;
+    result = arguments.readAndAssign<std::string>(gltf::load_nodes, &options) || result;
+    result = arguments.readAndAssign<std::string>(gltf::load_scene, &options) || result;
     result = arguments.readAndAssign<float>(gltf::maxAnisotropy, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::memory_map, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::merge_geometry, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::optimize_indices, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::packed_joints, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::parallel_build, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::probe, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::quantized_attributes, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::share_accessors, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::share_images, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::skip_animations, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::skip_cameras, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::skip_lights, &options) || result;
+    result = arguments.readAndAssign<bool>(gltf::skip_textures, &options) || result;
     return result;
 }
 
@@ -1864,8 +2420,31 @@ bool gltf::getFeatures(Features& features) const
     features.optionNameTypeMap[gltf::report] = vsg::type_name<bool>();
     features.optionNameTypeMap[gltf::culling] = vsg::type_name<bool>();
     features.optionNameTypeMap[gltf::disable_gltf] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::animation_sample_rate] = vsg::type_name<float>();
+    features.optionNameTypeMap[gltf::animation_tolerance] = vsg::type_name<float>();
     features.optionNameTypeMap[gltf::clone_accessors] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::cluster_size] = vsg::type_name<uint32_t>();
+    features.optionNameTypeMap[gltf::compact_buffers] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::compress_vertices] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::flatten_static_transforms] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::instance_threshold] = vsg::type_name<uint32_t>();
+    features.optionNameTypeMap[gltf::interleaved_vertices] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::load_nodes] = vsg::type_name<std::string>();
+    features.optionNameTypeMap[gltf::load_scene] = vsg::type_name<std::string>();
     features.optionNameTypeMap[gltf::maxAnisotropy] = vsg::type_name<float>();
+    features.optionNameTypeMap[gltf::memory_map] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::merge_geometry] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::optimize_indices] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::packed_joints] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::parallel_build] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::probe] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::quantized_attributes] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::share_accessors] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::share_images] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::skip_animations] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::skip_cameras] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::skip_lights] = vsg::type_name<bool>();
+    features.optionNameTypeMap[gltf::skip_textures] = vsg::type_name<bool>();
 
     return true;
 }
@@ -1913,9 +2492,88 @@ vsg::Path gltf::mimeTypeToExtension(const std::string_view& mimeType)
         return ".gif";
     else if (mimeType == "image/ktx")
         return ".ktx";
+    else if (mimeType == "image/ktx2")
+        return ".ktx2";
     return "";
 }
 
+bool gltf::imageDimensions(const uint8_t* ptr, size_t size, uint32_t& width, uint32_t& height)
+{
+    auto be16 = [&](size_t pos) { return static_cast<uint32_t>((ptr[pos] << 8) | ptr[pos + 1]); };
+    auto be32 = [&](size_t pos) { return (be16(pos) << 16) | be16(pos + 2); };
+    auto le16 = [&](size_t pos) { return static_cast<uint32_t>(ptr[pos] | (ptr[pos + 1] << 8)); };
+    auto le32 = [&](size_t pos) { return le16(pos) | (le16(pos + 2) << 16); };
+
+    static const uint8_t png_signature[] = {0x89, 'P', 'N', 'G', 0x0D, 0x0A, 0x1A, 0x0A};
+    static const uint8_t ktx_signature[] = {0xAB, 'K', 'T', 'X', ' ', '1', '1', 0xBB};
+    static const uint8_t ktx2_signature[] = {0xAB, 'K', 'T', 'X', ' ', '2', '0', 0xBB};
+
+    if (size >= 24 && std::memcmp(ptr, png_signature, sizeof(png_signature)) == 0)
+    {
+        width = be32(16);
+        height = be32(20);
+        return true;
+    }
+    else if (size >= 28 && std::memcmp(ptr, ktx2_signature, sizeof(ktx2_signature)) == 0)
+    {
+        width = le32(20);
+        height = std::max(le32(24), 1u);
+        return true;
+    }
+    else if (size >= 44 && std::memcmp(ptr, ktx_signature, sizeof(ktx_signature)) == 0)
+    {
+        width = le32(36);
+        height = std::max(le32(40), 1u);
+        return true;
+    }
+    else if (size >= 10 && (std::memcmp(ptr, "GIF87a", 6) == 0 || std::memcmp(ptr, "GIF89a", 6) == 0))
+    {
+        width = le16(6);
+        height = le16(8);
+        return true;
+    }
+    else if (size >= 26 && ptr[0] == 'B' && ptr[1] == 'M')
+    {
+        width = le32(18);
+        height = static_cast<uint32_t>(std::abs(static_cast<int32_t>(le32(22)))); // negative height for top down bitmaps
+        return true;
+    }
+    else if (size >= 20 && std::memcmp(ptr, "DDS ", 4) == 0)
+    {
+        height = le32(12);
+        width = le32(16);
+        return true;
+    }
+    else if (size >= 4 && ptr[0] == 0xFF && ptr[1] == 0xD8)
+    {
+        // walk the jpeg segments to the start of frame marker
+        size_t pos = 2;
+        while (pos + 9 <= size && ptr[pos] == 0xFF)
+        {
+            uint8_t marker = ptr[pos + 1];
+            if (marker == 0xFF)
+            {
+                ++pos; // fill byte
+            }
+            else if (marker >= 0xC0 && marker <= 0xCF && marker != 0xC4 && marker != 0xC8 && marker != 0xCC)
+            {
+                height = be16(pos + 5);
+                width = be16(pos + 7);
+                return true;
+            }
+            else if (marker == 0x01 || (marker >= 0xD0 && marker <= 0xD8))
+            {
+                pos += 2; // standalone markers
+            }
+            else
+            {
+                pos += 2 + be16(pos + 2);
+            }
+        }
+    }
+    return false;
+}
+
 void gltf::assignExtensions(vsg::JSONParser& parser) const
 {
     // set up the supported extensions
@@ -1923,8 +2581,10 @@ void gltf::assignExtensions(vsg::JSONParser& parser) const
     parser.setObject("KHR_materials_specular", KHR_materials_specular::create());
     parser.setObject("KHR_materials_ior", KHR_materials_ior::create());
     parser.setObject("EXT_mesh_gpu_instancing", EXT_mesh_gpu_instancing::create());
+    parser.setObject("EXT_meshopt_compression", EXT_meshopt_compression::create());
     parser.setObject("KHR_materials_unlit", KHR_materials_unlit::create());
     parser.setObject("KHR_texture_transform", KHR_texture_transform::create());
+    parser.setObject("KHR_texture_basisu", KHR_texture_basisu::create());
     parser.setObject("KHR_lights_punctual", KHR_lights_punctual::create());
     parser.setObject("KHR_materials_pbrSpecularGlossiness", KHR_materials_pbrSpecularGlossiness::create());
     parser.setObject("KHR_materials_emissive_strength", KHR_materials_emissive_strength::create());
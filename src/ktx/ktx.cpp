@@ -16,6 +16,7 @@ THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLI
 #include <vsg/core/MipmapLayout.h>
 #include <vsg/io/stream.h>
 #include <vsg/state/DescriptorImage.h>
+#include <vsg/utils/CommandLine.h>
 
 #include <ktx.h>
 #include <ktxvulkan.h>
@@ -60,7 +61,7 @@ namespace vsgXchange
 
         vsg::ref_ptr<vsg::Data> createImage(uint32_t arrayDimensions, uint32_t width, uint32_t height, uint32_t depth, uint8_t* data, vsg::Data::Properties properties, int valueSize, vsg::ref_ptr<vsg::MipmapLayout> mipmapLayout = {}) const;
         vsg::ref_ptr<vsg::Data> readKtx(ktxTexture* texture, const vsg::Path& filename) const;
-        vsg::ref_ptr<vsg::Data> readKtx2(ktxTexture2* texture, const vsg::Path& filename) const;
+        vsg::ref_ptr<vsg::Data> readKtx2(ktxTexture2* texture, const vsg::Path& filename, vsg::ref_ptr<const vsg::Options> options) const;
 
         struct Face
         {
@@ -122,6 +123,11 @@ bool ktx::getFeatures(Features& features) const
     return _implementation->getFeatures(features);
 }
 
+bool ktx::readOptions(vsg::Options& options, vsg::CommandLine& arguments) const
+{
+    return arguments.readAndAssign<TranscodeFormat>(ktx::transcode_format, &options);
+}
+
 ////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////////
 //
 // KTX ReaderWriter implementation
@@ -336,7 +342,7 @@ vsg::ref_ptr<vsg::Data> ktx::Implementation::readKtx(ktxTexture* texture, const
     return data;
 }
 
-vsg::ref_ptr<vsg::Data> ktx::Implementation::readKtx2(ktxTexture2* texture, const vsg::Path& filename) const
+vsg::ref_ptr<vsg::Data> ktx::Implementation::readKtx2(ktxTexture2* texture, const vsg::Path& filename, vsg::ref_ptr<const vsg::Options> options) const
 {
     uint32_t width = texture->baseWidth;
     uint32_t height = texture->baseHeight;
@@ -360,17 +366,33 @@ vsg::ref_ptr<vsg::Data> ktx::Implementation::readKtx2(ktxTexture2* texture, cons
 #endif
     if (ktxTexture2_NeedsTranscoding(texture))
     {
-        ktx_transcode_fmt_e fmt = KTX_TTF_RGBA32; // TODO value?
-#if 1
-        switch (numComponents)
+        ktx_transcode_fmt_e fmt = KTX_TTF_RGBA32;
+        switch (vsg::value<TranscodeFormat>(TranscodeFormat::bc, ktx::transcode_format, options))
         {
-        case (1): fmt = KTX_TTF_BC4_R; break;
-        case (2): fmt = KTX_TTF_BC5_RG; break;
-        case (3): fmt = KTX_TTF_BC1_RGB; break; // KTX_TTF_ETC1_RGB?
-        case (4):
-        default: fmt = KTX_TTF_BC7_RGBA; break; // KTX_TTF_ETC2_RGBA?
+        case (TranscodeFormat::bc):
+            switch (numComponents)
+            {
+            case (1): fmt = KTX_TTF_BC4_R; break;
+            case (2): fmt = KTX_TTF_BC5_RG; break;
+            case (3): fmt = KTX_TTF_BC1_RGB; break;
+            case (4):
+            default: fmt = KTX_TTF_BC7_RGBA; break;
+            }
+            break;
+        case (TranscodeFormat::etc):
+            switch (numComponents)
+            {
+            case (1): fmt = KTX_TTF_ETC2_EAC_R11; break;
+            case (2): fmt = KTX_TTF_ETC2_EAC_RG11; break;
+            case (3): fmt = KTX_TTF_ETC1_RGB; break;
+            case (4):
+            default: fmt = KTX_TTF_ETC2_RGBA; break;
+            }
+            break;
+        case (TranscodeFormat::astc): fmt = KTX_TTF_ASTC_4x4_RGBA; break;
+        case (TranscodeFormat::rgba):
+        default: fmt = KTX_TTF_RGBA32; break;
         }
-#endif
 
         ktx_transcode_flags transcodeFlags = 0;
 
@@ -515,7 +537,7 @@ vsg::ref_ptr<vsg::Object> ktx::Implementation::read(const vsg::Path& filename, v
         {
             ktxTexture2* texture = nullptr;
             result = ktxTexture2_CreateFromStdioStream(file, KTX_TEXTURE_CREATE_LOAD_IMAGE_DATA_BIT, &texture);
-            if (result == KTX_SUCCESS) data = readKtx2(texture, filename);
+            if (result == KTX_SUCCESS) data = readKtx2(texture, filename, options);
             if (texture) ktxTexture2_Destroy(texture);
         }
     }
@@ -557,7 +579,7 @@ vsg::ref_ptr<vsg::Object> ktx::Implementation::read(std::istream& fin, vsg::ref_
         vsg::ref_ptr<vsg::Data> data;
         try
         {
-            data = readKtx2(texture, "");
+            data = readKtx2(texture, "", options);
         }
         catch (const vsg::Exception& ve)
         {
@@ -582,7 +604,7 @@ vsg::ref_ptr<vsg::Object> ktx::Implementation::read(const uint8_t* ptr, size_t s
         vsg::ref_ptr<vsg::Data> data;
         try
         {
-            data = readKtx2(texture, "");
+            data = readKtx2(texture, "", options);
         }
         catch (const vsg::Exception& ve)
         {
@@ -603,5 +625,8 @@ bool ktx::Implementation::getFeatures(Features& features) const
     {
         features.extensionFeatureMap[ext] = static_cast<vsg::ReaderWriter::FeatureMask>(vsg::ReaderWriter::READ_FILENAME | vsg::ReaderWriter::READ_ISTREAM | vsg::ReaderWriter::READ_MEMORY);
     }
+
+    features.optionNameTypeMap[ktx::transcode_format] = vsg::type_name<TranscodeFormat>();
+
     return true;
 }
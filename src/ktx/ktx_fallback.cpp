@@ -46,3 +46,8 @@ bool ktx::getFeatures(Features&) const
 {
     return false;
 }
+
+bool ktx::readOptions(vsg::Options&, vsg::CommandLine&) const
+{
+    return false;
+}